@@ -0,0 +1,107 @@
+/*
+ * conf_rtos.h
+ *
+ * Configuracao do sistema multitarefas para este projeto
+ */ 
+
+#ifndef CONF_RTOS_H_
+#define CONF_RTOS_H_
+
+/* tabela estatica de tarefas, na ordem de criacao (o numero de tarefas e o
+   numero de entradas): funcao, nome, tamanho da pilha e prioridade */
+#define cfg_TABELA_DE_TAREFAS(TAREFA)											\
+	TAREFA(tarefa_1,	  "Tarefa 1",	   (TAM_MINIMO_PILHA + 24), 2)	\
+	TAREFA(tarefa_2,	  "Tarefa 2",	   (TAM_MINIMO_PILHA + 24), 1)	\
+	TAREFA(tarefa_9,	  "Tarefa 9",	   (TAM_MINIMO_PILHA + 24), 3)	\
+	TAREFA(tarefa_ociosa, "Tarefa ociosa", (TAM_MINIMO_PILHA + 24), 0)
+
+/* rejeita prioridades repetidas na tabela */
+#define cfg_PRIORIDADES_UNICAS	1
+
+/* numero de prioridades/tarefas */
+#define PRIORIDADE_MAXIMA   4	/* ate 255, o escalonador usa um mapa de bits */
+
+/* frequencia de clock da CPU */
+#define cfg_CPU_CLOCK_HZ 	48000000
+
+/* frequencia da marca de tempo do sistema multitarefas */
+#define cfg_MARCA_TEMPO_HZ  1000
+
+/* modo de escalonamento: ESCALONAMENTO_COOPERATIVO (as tarefas so trocam 
+   quando bloqueiam ou cedem o processador), ESCALONAMENTO_PREEMPTIVO (a cada 
+   marca de tempo, a tarefa pronta de maior prioridade assume o processador) ou
+   ESCALONAMENTO_FATIA_TEMPO (preemptivo, com rodizio entre as tarefas de mesma
+   prioridade a cada cfg_QUANTUM_MARCAS) */
+#define cfg_MODO_ESCALONAMENTO	ESCALONAMENTO_FATIA_TEMPO
+
+/* fatia de tempo padrao (em marcas) do rodizio entre tarefas de mesma prioridade,
+   0 desabilita o rodizio */
+#define cfg_QUANTUM_MARCAS  10
+
+/* modo sem marcas de tempo (tickless): com somente a tarefa ociosa pronta,
+   o processador dorme ate o proximo despertar de uma tarefa em espera */
+#define cfg_MODO_SEM_MARCA  0
+
+/* trabalhos adiados das interrupcoes: TrabalhoISR() coloca a funcao em um 
+   anel de cfg_TAM_TRABALHOS posicoes, executada pela tarefa TarefaTrabalhos, 
+   que deve ser criada pela aplicacao com prioridade alta */
+#define cfg_TRABALHOS_ISR		0
+#define cfg_TAM_TRABALHOS		16
+
+/* escalonamento EDF (prazo mais proximo primeiro): as tarefas periodicas
+   criadas com CriaTarefaEDF() ficam no nivel cfg_PRIORIDADE_EDF e, nele, 
+   executa a de prazo absoluto mais proximo. Cada ativacao termina com 
+   TarefaAguardaPeriodo(), que conta as perdas de prazo */
+#define cfg_EDF					0
+#define cfg_PRIORIDADE_EDF		1
+
+/* orcamentos de execucao: TarefaOrcamento() limita as marcas de execucao 
+   de cada ativacao da tarefa, verificadas na marca de tempo; no estouro, a 
+   tarefa e contada, rebaixada para cfg_PRIORIDADE_REBAIXADA ou suspensa. 
+   As perdas de prazo e os estouros ficam em um registro de cfg_OCORRENCIAS 
+   entradas (OcorrenciasRecentes()) */
+#define cfg_ORCAMENTOS			0
+#define cfg_PRIORIDADE_REBAIXADA	1
+#define cfg_OCORRENCIAS			16
+
+/* rastro dos eventos do nucleo: trocas de contexto, tarefas prontas e 
+   bloqueadas, despertares na marca de tempo e semaforos, com o instante de
+   LeCiclos(), em um anel de cfg_TAM_RASTRO registros de 8 bytes (potencia 
+   de 2). A copia da memoria da variavel rastro e decodificada no computador
+   por ferramentas/decodifica_rastro */
+#define cfg_RASTRO				0
+#define cfg_TAM_RASTRO			256
+
+/* temporizadores de software: TemporizadorInicia() programa uma funcao para
+   uma vez ou com recarga automatica, executada pela tarefa 
+   TarefaTemporizadores, que deve ser criada pela aplicacao com prioridade alta */
+#define cfg_TEMPORIZADORES		0
+
+/* tarefas dinamicas (CriaTarefaDinamica()): numero de pilhas de 
+   cfg_TAM_PILHA_DINAMICA palavras do conjunto de pilhas. As tarefas 
+   terminadas (TarefaTermina(), TarefaApaga() ou retorno da funcao da tarefa)
+   devolvem o TCB e a pilha */
+#define cfg_TAREFAS_DINAMICAS	0
+#define cfg_TAM_PILHA_DINAMICA	(TAM_MINIMO_PILHA + 64)
+
+/* verificacao do estouro de pilha a cada troca de contexto: a tarefa que sai 
+   deve ter o ponteiro de pilha dentro da sua area e a primeira palavra da 
+   pilha com o padrao da criacao, senao EstouroDePilha() e chamada */
+#define cfg_VERIFICA_PILHA		1
+
+/* medidas de latencia da troca de contexto e das interrupcoes ate a tarefa 
+   acordada (LatenciasTarefa(), LatenciasRecentes()), com um anel das 
+   cfg_AMOSTRAS_LATENCIA amostras mais recentes */
+#define cfg_MEDIDAS_LATENCIA	0
+#define cfg_AMOSTRAS_LATENCIA	32
+
+/* medida do maior tempo com as interrupcoes desabilitadas (regiao critica 
+   mais externa) de cada servico do sistema (RegioesAtomicasMedidas()) */
+#define cfg_MEDIDAS_REGIAO_ATOMICA	0
+#define cfg_SERVICOS_MEDIDOS		32
+
+/* estatisticas de execucao das tarefas (TarefaEstatisticas()): tempo de 
+   execucao, entradas e uso da CPU de cada tarefa */
+#define cfg_ESTATISTICAS		0
+
+#endif /* CONF_RTOS_H_ */
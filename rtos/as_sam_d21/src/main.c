@@ -42,32 +42,8 @@ void tarefa_7(void);
 void tarefa_8(void);
 void tarefa_9(void);
 /*
- * Configuracao dos tamanhos das pilhas
+ * As pilhas das tarefas sao definidas pela tabela de tarefas (conf_rtos.h)
  */
-#define TAM_PILHA_1			(TAM_MINIMO_PILHA + 24)
-#define TAM_PILHA_2			(TAM_MINIMO_PILHA + 24)
-#define TAM_PILHA_3			(TAM_MINIMO_PILHA + 24)
-#define TAM_PILHA_4			(TAM_MINIMO_PILHA + 24)
-#define TAM_PILHA_5			(TAM_MINIMO_PILHA + 24)
-#define TAM_PILHA_6			(TAM_MINIMO_PILHA + 24)
-#define TAM_PILHA_7			(TAM_MINIMO_PILHA + 24)
-#define TAM_PILHA_8			(TAM_MINIMO_PILHA + 24)
-#define TAM_PILHA_9		    (TAM_MINIMO_PILHA + 24)
-#define TAM_PILHA_OCIOSA	(TAM_MINIMO_PILHA + 24)
-
-/*
- * Declaracao das pilhas das tarefas
- */
-uint32_t PILHA_TAREFA_1[TAM_PILHA_1];
-uint32_t PILHA_TAREFA_2[TAM_PILHA_2];
-uint32_t PILHA_TAREFA_3[TAM_PILHA_3];
-uint32_t PILHA_TAREFA_4[TAM_PILHA_4];
-uint32_t PILHA_TAREFA_5[TAM_PILHA_5];
-uint32_t PILHA_TAREFA_6[TAM_PILHA_6];
-uint32_t PILHA_TAREFA_7[TAM_PILHA_7];
-uint32_t PILHA_TAREFA_8[TAM_PILHA_8];
-uint32_t PILHA_TAREFA_8[TAM_PILHA_9];
-uint32_t PILHA_TAREFA_OCIOSA[TAM_PILHA_OCIOSA];
 
 /*
  * Funcao principal de entrada do sistema
@@ -79,22 +55,10 @@ int main(void)
 	system_init();
 #endif
 	
-	/* Criacao das tarefas */
-	/* Parametros: ponteiro, nome, ponteiro da pilha, tamanho da pilha, prioridade da tarefa */
-    
-	CriaTarefa(tarefa_1, "Tarefa 1", PILHA_TAREFA_1, TAM_PILHA_1, 2);
-	
-	CriaTarefa(tarefa_2, "Tarefa 2", PILHA_TAREFA_2, TAM_PILHA_2, 1);
-
-	CriaTarefa(tarefa_9, "Tarefa 9", PILHA_TAREFA_9, TAM_PILHA_9, 3);  
-	
-	/* Cria tarefa ociosa do sistema */
-	CriaTarefa(tarefa_ociosa,"Tarefa ociosa", PILHA_TAREFA_OCIOSA, TAM_PILHA_OCIOSA, 0);
-	
 	/* Configura marca de tempo */
 	ConfiguraMarcaTempo();   
 	
-	/* Inicia sistema multitarefas */
+	/* Cria as tarefas da tabela e inicia o sistema multitarefas */
 	IniciaMultitarefas();
 	
 	/* Nunca chega aqui */
@@ -111,7 +75,7 @@ void tarefa_1(void)
 	{
 		a++;
 		port_pin_set_output_level(LED_0_PIN, LED_0_ACTIVE); /* Liga LED. */
-		TarefaContinua(2);
+		TarefaContinua(ID_tarefa_2);
 	
 	}
 }
@@ -122,7 +86,7 @@ void tarefa_2(void)
 	for(;;)
 	{
 		b++;
-		TarefaSuspende(2);	
+		TarefaSuspende(ID_tarefa_2);	
 		port_pin_set_output_level(LED_0_PIN, !LED_0_ACTIVE); 	/* Turn LED off. */
 	}
 }
@@ -157,7 +121,7 @@ void tarefa_4(void)
 
 /* Tarefas de exemplo que usam funcoes de semaforo */
 
-semaforo_t SemaforoTeste = {0,0}; /* declaracao e inicializacao de um semaforo */
+semaforo_t SemaforoTeste = {0,{0}}; /* declaracao e inicializacao de um semaforo */
 
 void tarefa_5(void)
 {
@@ -198,8 +162,8 @@ void tarefa_6(void)
 #define TAM_BUFFER 10
 uint8_t buffer[TAM_BUFFER]; /* declaracao de um buffer (vetor) ou fila circular */
 
-semaforo_t SemaforoCheio = {0,0}; /* declaracao e inicializacao de um semaforo */
-semaforo_t SemaforoVazio = {TAM_BUFFER,0}; /* declaracao e inicializacao de um semaforo */
+semaforo_t SemaforoCheio = {0,{0}}; /* declaracao e inicializacao de um semaforo */
+semaforo_t SemaforoVazio = {TAM_BUFFER,{0}}; /* declaracao e inicializacao de um semaforo */
 
 void tarefa_7(void)
 {
@@ -228,21 +192,11 @@ void tarefa_8(void)
 		
 	for(;;)
 	{
-		volatile uint8_t contador;
-		
-		do{
-			REG_ATOMICA_INICIO();			
-				contador = SemaforoCheio.contador;			
-			REG_ATOMICA_FIM();
-			
-			if (contador == 0)
-			{
-				TarefaEspera(100);
-			}
-				
-		} while (!contador);
-		
-		SemaforoAguarda(&SemaforoCheio);
+		/* espera um dado no buffer por no maximo 100 marcas de tempo */
+		if(SemaforoAguardaTempo(&SemaforoCheio, 100) != SUCESSO)
+		{
+			continue;		/* tempo esgotado, nenhum dado no buffer */
+		}
 		
 		valor = buffer[f];
 		f = (f+1) % TAM_BUFFER;		
@@ -254,10 +208,11 @@ void tarefa_8(void)
 void tarefa_9(void)
 {
     volatile uint16_t contador = 0;
+    tick_t ultimo_despertar = MarcasDeTempo();
     for(;;)
     {
         contador++;
 		
-        TarefaEspera(100);  // espera 500ms
+        TarefaEsperaAte(&ultimo_despertar, 100);  // periodo de 100 marcas (100ms), sem acumulo de atraso
     }
 }
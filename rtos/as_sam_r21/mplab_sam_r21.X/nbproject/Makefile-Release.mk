@@ -51,17 +51,17 @@ OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
 DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
 
 # Source Files Quoted if spaced
-SOURCEFILES_QUOTED_IF_SPACED=../src/ASF/common/utils/interrupt/interrupt_sam_nvic.c ../src/ASF/sam0/boards/samr21_xplained_pro/board_init.c ../src/ASF/sam0/drivers/port/port.c ../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1/clock.c ../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1/gclk.c ../src/ASF/sam0/drivers/system/interrupt/system_interrupt.c ../src/ASF/sam0/drivers/system/pinmux/pinmux.c ../src/ASF/sam0/drivers/system/system.c ../src/ASF/sam0/utils/cmsis/samr21/source/gcc/startup_samr21.c ../src/ASF/sam0/utils/cmsis/samr21/source/system_samr21.c ../src/ASF/sam0/utils/syscalls/gcc/syscalls.c ../src/cpu-port.c ../src/rtos.c ../src/main.c
+SOURCEFILES_QUOTED_IF_SPACED=../src/ASF/common/utils/interrupt/interrupt_sam_nvic.c ../src/ASF/sam0/boards/samr21_xplained_pro/board_init.c ../src/ASF/sam0/drivers/port/port.c ../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1/clock.c ../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1/gclk.c ../src/ASF/sam0/drivers/system/interrupt/system_interrupt.c ../src/ASF/sam0/drivers/system/pinmux/pinmux.c ../src/ASF/sam0/drivers/system/system.c ../src/ASF/sam0/utils/cmsis/samr21/source/gcc/startup_samr21.c ../src/ASF/sam0/utils/cmsis/samr21/source/system_samr21.c ../src/ASF/sam0/utils/syscalls/gcc/syscalls.c ../../port/arm_cm0_gcc/cpu-port.c ../../kernel/rtos.c ../src/main.c
 
 # Object Files Quoted if spaced
-OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/_ext/1939168694/interrupt_sam_nvic.o ${OBJECTDIR}/_ext/1350218445/board_init.o ${OBJECTDIR}/_ext/876312722/port.o ${OBJECTDIR}/_ext/1900123450/clock.o ${OBJECTDIR}/_ext/1900123450/gclk.o ${OBJECTDIR}/_ext/1234282992/system_interrupt.o ${OBJECTDIR}/_ext/980481618/pinmux.o ${OBJECTDIR}/_ext/227780132/system.o ${OBJECTDIR}/_ext/386045837/startup_samr21.o ${OBJECTDIR}/_ext/2084470165/system_samr21.o ${OBJECTDIR}/_ext/1284275751/syscalls.o ${OBJECTDIR}/_ext/1360937237/cpu-port.o ${OBJECTDIR}/_ext/1360937237/rtos.o ${OBJECTDIR}/_ext/1360937237/main.o
-POSSIBLE_DEPFILES=${OBJECTDIR}/_ext/1939168694/interrupt_sam_nvic.o.d ${OBJECTDIR}/_ext/1350218445/board_init.o.d ${OBJECTDIR}/_ext/876312722/port.o.d ${OBJECTDIR}/_ext/1900123450/clock.o.d ${OBJECTDIR}/_ext/1900123450/gclk.o.d ${OBJECTDIR}/_ext/1234282992/system_interrupt.o.d ${OBJECTDIR}/_ext/980481618/pinmux.o.d ${OBJECTDIR}/_ext/227780132/system.o.d ${OBJECTDIR}/_ext/386045837/startup_samr21.o.d ${OBJECTDIR}/_ext/2084470165/system_samr21.o.d ${OBJECTDIR}/_ext/1284275751/syscalls.o.d ${OBJECTDIR}/_ext/1360937237/cpu-port.o.d ${OBJECTDIR}/_ext/1360937237/rtos.o.d ${OBJECTDIR}/_ext/1360937237/main.o.d
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/_ext/1939168694/interrupt_sam_nvic.o ${OBJECTDIR}/_ext/1350218445/board_init.o ${OBJECTDIR}/_ext/876312722/port.o ${OBJECTDIR}/_ext/1900123450/clock.o ${OBJECTDIR}/_ext/1900123450/gclk.o ${OBJECTDIR}/_ext/1234282992/system_interrupt.o ${OBJECTDIR}/_ext/980481618/pinmux.o ${OBJECTDIR}/_ext/227780132/system.o ${OBJECTDIR}/_ext/386045837/startup_samr21.o ${OBJECTDIR}/_ext/2084470165/system_samr21.o ${OBJECTDIR}/_ext/1284275751/syscalls.o ${OBJECTDIR}/_ext/690257283/cpu-port.o ${OBJECTDIR}/_ext/1109276195/rtos.o ${OBJECTDIR}/_ext/1360937237/main.o
+POSSIBLE_DEPFILES=${OBJECTDIR}/_ext/1939168694/interrupt_sam_nvic.o.d ${OBJECTDIR}/_ext/1350218445/board_init.o.d ${OBJECTDIR}/_ext/876312722/port.o.d ${OBJECTDIR}/_ext/1900123450/clock.o.d ${OBJECTDIR}/_ext/1900123450/gclk.o.d ${OBJECTDIR}/_ext/1234282992/system_interrupt.o.d ${OBJECTDIR}/_ext/980481618/pinmux.o.d ${OBJECTDIR}/_ext/227780132/system.o.d ${OBJECTDIR}/_ext/386045837/startup_samr21.o.d ${OBJECTDIR}/_ext/2084470165/system_samr21.o.d ${OBJECTDIR}/_ext/1284275751/syscalls.o.d ${OBJECTDIR}/_ext/690257283/cpu-port.o.d ${OBJECTDIR}/_ext/1109276195/rtos.o.d ${OBJECTDIR}/_ext/1360937237/main.o.d
 
 # Object Files
-OBJECTFILES=${OBJECTDIR}/_ext/1939168694/interrupt_sam_nvic.o ${OBJECTDIR}/_ext/1350218445/board_init.o ${OBJECTDIR}/_ext/876312722/port.o ${OBJECTDIR}/_ext/1900123450/clock.o ${OBJECTDIR}/_ext/1900123450/gclk.o ${OBJECTDIR}/_ext/1234282992/system_interrupt.o ${OBJECTDIR}/_ext/980481618/pinmux.o ${OBJECTDIR}/_ext/227780132/system.o ${OBJECTDIR}/_ext/386045837/startup_samr21.o ${OBJECTDIR}/_ext/2084470165/system_samr21.o ${OBJECTDIR}/_ext/1284275751/syscalls.o ${OBJECTDIR}/_ext/1360937237/cpu-port.o ${OBJECTDIR}/_ext/1360937237/rtos.o ${OBJECTDIR}/_ext/1360937237/main.o
+OBJECTFILES=${OBJECTDIR}/_ext/1939168694/interrupt_sam_nvic.o ${OBJECTDIR}/_ext/1350218445/board_init.o ${OBJECTDIR}/_ext/876312722/port.o ${OBJECTDIR}/_ext/1900123450/clock.o ${OBJECTDIR}/_ext/1900123450/gclk.o ${OBJECTDIR}/_ext/1234282992/system_interrupt.o ${OBJECTDIR}/_ext/980481618/pinmux.o ${OBJECTDIR}/_ext/227780132/system.o ${OBJECTDIR}/_ext/386045837/startup_samr21.o ${OBJECTDIR}/_ext/2084470165/system_samr21.o ${OBJECTDIR}/_ext/1284275751/syscalls.o ${OBJECTDIR}/_ext/690257283/cpu-port.o ${OBJECTDIR}/_ext/1109276195/rtos.o ${OBJECTDIR}/_ext/1360937237/main.o
 
 # Source Files
-SOURCEFILES=../src/ASF/common/utils/interrupt/interrupt_sam_nvic.c ../src/ASF/sam0/boards/samr21_xplained_pro/board_init.c ../src/ASF/sam0/drivers/port/port.c ../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1/clock.c ../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1/gclk.c ../src/ASF/sam0/drivers/system/interrupt/system_interrupt.c ../src/ASF/sam0/drivers/system/pinmux/pinmux.c ../src/ASF/sam0/drivers/system/system.c ../src/ASF/sam0/utils/cmsis/samr21/source/gcc/startup_samr21.c ../src/ASF/sam0/utils/cmsis/samr21/source/system_samr21.c ../src/ASF/sam0/utils/syscalls/gcc/syscalls.c ../src/cpu-port.c ../src/rtos.c ../src/main.c
+SOURCEFILES=../src/ASF/common/utils/interrupt/interrupt_sam_nvic.c ../src/ASF/sam0/boards/samr21_xplained_pro/board_init.c ../src/ASF/sam0/drivers/port/port.c ../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1/clock.c ../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1/gclk.c ../src/ASF/sam0/drivers/system/interrupt/system_interrupt.c ../src/ASF/sam0/drivers/system/pinmux/pinmux.c ../src/ASF/sam0/drivers/system/system.c ../src/ASF/sam0/utils/cmsis/samr21/source/gcc/startup_samr21.c ../src/ASF/sam0/utils/cmsis/samr21/source/system_samr21.c ../src/ASF/sam0/utils/syscalls/gcc/syscalls.c ../../port/arm_cm0_gcc/cpu-port.c ../../kernel/rtos.c ../src/main.c
 
 # Pack Options 
 PACK_COMMON_OPTIONS=-I "${DFP_DIR}/include"  -I "${CMSIS_DIR}/CMSIS/Core/Include"
@@ -107,170 +107,170 @@ ${OBJECTDIR}/_ext/1939168694/interrupt_sam_nvic.o: ../src/ASF/common/utils/inter
 	@${MKDIR} "${OBJECTDIR}/_ext/1939168694" 
 	@${RM} ${OBJECTDIR}/_ext/1939168694/interrupt_sam_nvic.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1939168694/interrupt_sam_nvic.o 
-	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1 -gdwarf-2  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1939168694/interrupt_sam_nvic.o.d" -o ${OBJECTDIR}/_ext/1939168694/interrupt_sam_nvic.o ../src/ASF/common/utils/interrupt/interrupt_sam_nvic.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1 -gdwarf-2  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../../kernel" -I "../../port/arm_cm0_gcc" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1939168694/interrupt_sam_nvic.o.d" -o ${OBJECTDIR}/_ext/1939168694/interrupt_sam_nvic.o ../src/ASF/common/utils/interrupt/interrupt_sam_nvic.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
 	
 ${OBJECTDIR}/_ext/1350218445/board_init.o: ../src/ASF/sam0/boards/samr21_xplained_pro/board_init.c  .generated_files/flags/Release/3dc89b71c6ea39879c40dd0ae936b05d6688aa00 .generated_files/flags/Release/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1350218445" 
 	@${RM} ${OBJECTDIR}/_ext/1350218445/board_init.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1350218445/board_init.o 
-	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1 -gdwarf-2  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1350218445/board_init.o.d" -o ${OBJECTDIR}/_ext/1350218445/board_init.o ../src/ASF/sam0/boards/samr21_xplained_pro/board_init.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1 -gdwarf-2  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../../kernel" -I "../../port/arm_cm0_gcc" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1350218445/board_init.o.d" -o ${OBJECTDIR}/_ext/1350218445/board_init.o ../src/ASF/sam0/boards/samr21_xplained_pro/board_init.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
 	
 ${OBJECTDIR}/_ext/876312722/port.o: ../src/ASF/sam0/drivers/port/port.c  .generated_files/flags/Release/f8df011b7616689f2966af15388f375926036680 .generated_files/flags/Release/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/876312722" 
 	@${RM} ${OBJECTDIR}/_ext/876312722/port.o.d 
 	@${RM} ${OBJECTDIR}/_ext/876312722/port.o 
-	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1 -gdwarf-2  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/876312722/port.o.d" -o ${OBJECTDIR}/_ext/876312722/port.o ../src/ASF/sam0/drivers/port/port.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1 -gdwarf-2  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../../kernel" -I "../../port/arm_cm0_gcc" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/876312722/port.o.d" -o ${OBJECTDIR}/_ext/876312722/port.o ../src/ASF/sam0/drivers/port/port.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
 	
 ${OBJECTDIR}/_ext/1900123450/clock.o: ../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1/clock.c  .generated_files/flags/Release/39002a1612915d9e437539c57b918c61f732de67 .generated_files/flags/Release/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1900123450" 
 	@${RM} ${OBJECTDIR}/_ext/1900123450/clock.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1900123450/clock.o 
-	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1 -gdwarf-2  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1900123450/clock.o.d" -o ${OBJECTDIR}/_ext/1900123450/clock.o ../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1/clock.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1 -gdwarf-2  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../../kernel" -I "../../port/arm_cm0_gcc" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1900123450/clock.o.d" -o ${OBJECTDIR}/_ext/1900123450/clock.o ../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1/clock.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
 	
 ${OBJECTDIR}/_ext/1900123450/gclk.o: ../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1/gclk.c  .generated_files/flags/Release/760d13f50ec13ba0b52a944f04f69ed1b6ddf8e4 .generated_files/flags/Release/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1900123450" 
 	@${RM} ${OBJECTDIR}/_ext/1900123450/gclk.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1900123450/gclk.o 
-	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1 -gdwarf-2  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1900123450/gclk.o.d" -o ${OBJECTDIR}/_ext/1900123450/gclk.o ../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1/gclk.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1 -gdwarf-2  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../../kernel" -I "../../port/arm_cm0_gcc" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1900123450/gclk.o.d" -o ${OBJECTDIR}/_ext/1900123450/gclk.o ../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1/gclk.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
 	
 ${OBJECTDIR}/_ext/1234282992/system_interrupt.o: ../src/ASF/sam0/drivers/system/interrupt/system_interrupt.c  .generated_files/flags/Release/83c48cae6adb99a341aaa719145c2d53be20ff51 .generated_files/flags/Release/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1234282992" 
 	@${RM} ${OBJECTDIR}/_ext/1234282992/system_interrupt.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1234282992/system_interrupt.o 
-	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1 -gdwarf-2  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1234282992/system_interrupt.o.d" -o ${OBJECTDIR}/_ext/1234282992/system_interrupt.o ../src/ASF/sam0/drivers/system/interrupt/system_interrupt.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1 -gdwarf-2  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../../kernel" -I "../../port/arm_cm0_gcc" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1234282992/system_interrupt.o.d" -o ${OBJECTDIR}/_ext/1234282992/system_interrupt.o ../src/ASF/sam0/drivers/system/interrupt/system_interrupt.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
 	
 ${OBJECTDIR}/_ext/980481618/pinmux.o: ../src/ASF/sam0/drivers/system/pinmux/pinmux.c  .generated_files/flags/Release/97b94b77f990cb1b8395e5a3d4b5af255a7331d2 .generated_files/flags/Release/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/980481618" 
 	@${RM} ${OBJECTDIR}/_ext/980481618/pinmux.o.d 
 	@${RM} ${OBJECTDIR}/_ext/980481618/pinmux.o 
-	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1 -gdwarf-2  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/980481618/pinmux.o.d" -o ${OBJECTDIR}/_ext/980481618/pinmux.o ../src/ASF/sam0/drivers/system/pinmux/pinmux.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1 -gdwarf-2  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../../kernel" -I "../../port/arm_cm0_gcc" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/980481618/pinmux.o.d" -o ${OBJECTDIR}/_ext/980481618/pinmux.o ../src/ASF/sam0/drivers/system/pinmux/pinmux.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
 	
 ${OBJECTDIR}/_ext/227780132/system.o: ../src/ASF/sam0/drivers/system/system.c  .generated_files/flags/Release/6335522ad4d960648024dc51d7224561f430e061 .generated_files/flags/Release/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/227780132" 
 	@${RM} ${OBJECTDIR}/_ext/227780132/system.o.d 
 	@${RM} ${OBJECTDIR}/_ext/227780132/system.o 
-	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1 -gdwarf-2  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/227780132/system.o.d" -o ${OBJECTDIR}/_ext/227780132/system.o ../src/ASF/sam0/drivers/system/system.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1 -gdwarf-2  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../../kernel" -I "../../port/arm_cm0_gcc" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/227780132/system.o.d" -o ${OBJECTDIR}/_ext/227780132/system.o ../src/ASF/sam0/drivers/system/system.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
 	
 ${OBJECTDIR}/_ext/386045837/startup_samr21.o: ../src/ASF/sam0/utils/cmsis/samr21/source/gcc/startup_samr21.c  .generated_files/flags/Release/4fe9503830f82cc5ec677d74b3fcd308e75234bd .generated_files/flags/Release/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/386045837" 
 	@${RM} ${OBJECTDIR}/_ext/386045837/startup_samr21.o.d 
 	@${RM} ${OBJECTDIR}/_ext/386045837/startup_samr21.o 
-	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1 -gdwarf-2  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/386045837/startup_samr21.o.d" -o ${OBJECTDIR}/_ext/386045837/startup_samr21.o ../src/ASF/sam0/utils/cmsis/samr21/source/gcc/startup_samr21.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1 -gdwarf-2  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../../kernel" -I "../../port/arm_cm0_gcc" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/386045837/startup_samr21.o.d" -o ${OBJECTDIR}/_ext/386045837/startup_samr21.o ../src/ASF/sam0/utils/cmsis/samr21/source/gcc/startup_samr21.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
 	
 ${OBJECTDIR}/_ext/2084470165/system_samr21.o: ../src/ASF/sam0/utils/cmsis/samr21/source/system_samr21.c  .generated_files/flags/Release/80e7073d5de69725a015584ff46ce47a7e4f3dee .generated_files/flags/Release/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/2084470165" 
 	@${RM} ${OBJECTDIR}/_ext/2084470165/system_samr21.o.d 
 	@${RM} ${OBJECTDIR}/_ext/2084470165/system_samr21.o 
-	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1 -gdwarf-2  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/2084470165/system_samr21.o.d" -o ${OBJECTDIR}/_ext/2084470165/system_samr21.o ../src/ASF/sam0/utils/cmsis/samr21/source/system_samr21.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1 -gdwarf-2  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../../kernel" -I "../../port/arm_cm0_gcc" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/2084470165/system_samr21.o.d" -o ${OBJECTDIR}/_ext/2084470165/system_samr21.o ../src/ASF/sam0/utils/cmsis/samr21/source/system_samr21.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
 	
 ${OBJECTDIR}/_ext/1284275751/syscalls.o: ../src/ASF/sam0/utils/syscalls/gcc/syscalls.c  .generated_files/flags/Release/fbe9140907e05e2f9e15e612719f376279dd179e .generated_files/flags/Release/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1284275751" 
 	@${RM} ${OBJECTDIR}/_ext/1284275751/syscalls.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1284275751/syscalls.o 
-	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1 -gdwarf-2  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1284275751/syscalls.o.d" -o ${OBJECTDIR}/_ext/1284275751/syscalls.o ../src/ASF/sam0/utils/syscalls/gcc/syscalls.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1 -gdwarf-2  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../../kernel" -I "../../port/arm_cm0_gcc" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1284275751/syscalls.o.d" -o ${OBJECTDIR}/_ext/1284275751/syscalls.o ../src/ASF/sam0/utils/syscalls/gcc/syscalls.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
 	
-${OBJECTDIR}/_ext/1360937237/cpu-port.o: ../src/cpu-port.c  .generated_files/flags/Release/707b29ed74160adbc139419538d08727ed9ad6e5 .generated_files/flags/Release/da39a3ee5e6b4b0d3255bfef95601890afd80709
-	@${MKDIR} "${OBJECTDIR}/_ext/1360937237" 
-	@${RM} ${OBJECTDIR}/_ext/1360937237/cpu-port.o.d 
-	@${RM} ${OBJECTDIR}/_ext/1360937237/cpu-port.o 
-	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1 -gdwarf-2  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1360937237/cpu-port.o.d" -o ${OBJECTDIR}/_ext/1360937237/cpu-port.o ../src/cpu-port.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
+${OBJECTDIR}/_ext/690257283/cpu-port.o: ../../port/arm_cm0_gcc/cpu-port.c  .generated_files/flags/Release/707b29ed74160adbc139419538d08727ed9ad6e5 .generated_files/flags/Release/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/690257283" 
+	@${RM} ${OBJECTDIR}/_ext/690257283/cpu-port.o.d 
+	@${RM} ${OBJECTDIR}/_ext/690257283/cpu-port.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1 -gdwarf-2  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../../kernel" -I "../../port/arm_cm0_gcc" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/690257283/cpu-port.o.d" -o ${OBJECTDIR}/_ext/690257283/cpu-port.o ../../port/arm_cm0_gcc/cpu-port.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
 	
-${OBJECTDIR}/_ext/1360937237/rtos.o: ../src/rtos.c  .generated_files/flags/Release/857e6906aae23f5442bc03481e7c1fa04729a9ed .generated_files/flags/Release/da39a3ee5e6b4b0d3255bfef95601890afd80709
-	@${MKDIR} "${OBJECTDIR}/_ext/1360937237" 
-	@${RM} ${OBJECTDIR}/_ext/1360937237/rtos.o.d 
-	@${RM} ${OBJECTDIR}/_ext/1360937237/rtos.o 
-	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1 -gdwarf-2  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1360937237/rtos.o.d" -o ${OBJECTDIR}/_ext/1360937237/rtos.o ../src/rtos.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
+${OBJECTDIR}/_ext/1109276195/rtos.o: ../../kernel/rtos.c  .generated_files/flags/Release/857e6906aae23f5442bc03481e7c1fa04729a9ed .generated_files/flags/Release/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1109276195" 
+	@${RM} ${OBJECTDIR}/_ext/1109276195/rtos.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1109276195/rtos.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1 -gdwarf-2  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../../kernel" -I "../../port/arm_cm0_gcc" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1109276195/rtos.o.d" -o ${OBJECTDIR}/_ext/1109276195/rtos.o ../../kernel/rtos.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
 	
 ${OBJECTDIR}/_ext/1360937237/main.o: ../src/main.c  .generated_files/flags/Release/92093a3ba899e74332e5b68b8fdedc5293544709 .generated_files/flags/Release/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1360937237" 
 	@${RM} ${OBJECTDIR}/_ext/1360937237/main.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1360937237/main.o 
-	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1 -gdwarf-2  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1360937237/main.o.d" -o ${OBJECTDIR}/_ext/1360937237/main.o ../src/main.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1 -gdwarf-2  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../../kernel" -I "../../port/arm_cm0_gcc" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1360937237/main.o.d" -o ${OBJECTDIR}/_ext/1360937237/main.o ../src/main.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
 	
 else
 ${OBJECTDIR}/_ext/1939168694/interrupt_sam_nvic.o: ../src/ASF/common/utils/interrupt/interrupt_sam_nvic.c  .generated_files/flags/Release/b1510c0ec4038ba086917bd52c50d9b24e4651db .generated_files/flags/Release/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1939168694" 
 	@${RM} ${OBJECTDIR}/_ext/1939168694/interrupt_sam_nvic.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1939168694/interrupt_sam_nvic.o 
-	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1939168694/interrupt_sam_nvic.o.d" -o ${OBJECTDIR}/_ext/1939168694/interrupt_sam_nvic.o ../src/ASF/common/utils/interrupt/interrupt_sam_nvic.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../../kernel" -I "../../port/arm_cm0_gcc" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1939168694/interrupt_sam_nvic.o.d" -o ${OBJECTDIR}/_ext/1939168694/interrupt_sam_nvic.o ../src/ASF/common/utils/interrupt/interrupt_sam_nvic.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
 	
 ${OBJECTDIR}/_ext/1350218445/board_init.o: ../src/ASF/sam0/boards/samr21_xplained_pro/board_init.c  .generated_files/flags/Release/a4d20b144e6cbf313624f51ffae5e020d9f48277 .generated_files/flags/Release/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1350218445" 
 	@${RM} ${OBJECTDIR}/_ext/1350218445/board_init.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1350218445/board_init.o 
-	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1350218445/board_init.o.d" -o ${OBJECTDIR}/_ext/1350218445/board_init.o ../src/ASF/sam0/boards/samr21_xplained_pro/board_init.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../../kernel" -I "../../port/arm_cm0_gcc" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1350218445/board_init.o.d" -o ${OBJECTDIR}/_ext/1350218445/board_init.o ../src/ASF/sam0/boards/samr21_xplained_pro/board_init.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
 	
 ${OBJECTDIR}/_ext/876312722/port.o: ../src/ASF/sam0/drivers/port/port.c  .generated_files/flags/Release/78950e8e3ce604b74fba9bc7f859bb8acc36521 .generated_files/flags/Release/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/876312722" 
 	@${RM} ${OBJECTDIR}/_ext/876312722/port.o.d 
 	@${RM} ${OBJECTDIR}/_ext/876312722/port.o 
-	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/876312722/port.o.d" -o ${OBJECTDIR}/_ext/876312722/port.o ../src/ASF/sam0/drivers/port/port.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../../kernel" -I "../../port/arm_cm0_gcc" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/876312722/port.o.d" -o ${OBJECTDIR}/_ext/876312722/port.o ../src/ASF/sam0/drivers/port/port.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
 	
 ${OBJECTDIR}/_ext/1900123450/clock.o: ../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1/clock.c  .generated_files/flags/Release/9997066803f19c693386e5aa46bfa93d0b46ebe4 .generated_files/flags/Release/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1900123450" 
 	@${RM} ${OBJECTDIR}/_ext/1900123450/clock.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1900123450/clock.o 
-	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1900123450/clock.o.d" -o ${OBJECTDIR}/_ext/1900123450/clock.o ../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1/clock.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../../kernel" -I "../../port/arm_cm0_gcc" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1900123450/clock.o.d" -o ${OBJECTDIR}/_ext/1900123450/clock.o ../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1/clock.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
 	
 ${OBJECTDIR}/_ext/1900123450/gclk.o: ../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1/gclk.c  .generated_files/flags/Release/a4b6f5dcc96158f1c2d7cbd46ad4375e10f9ab70 .generated_files/flags/Release/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1900123450" 
 	@${RM} ${OBJECTDIR}/_ext/1900123450/gclk.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1900123450/gclk.o 
-	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1900123450/gclk.o.d" -o ${OBJECTDIR}/_ext/1900123450/gclk.o ../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1/gclk.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../../kernel" -I "../../port/arm_cm0_gcc" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1900123450/gclk.o.d" -o ${OBJECTDIR}/_ext/1900123450/gclk.o ../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1/gclk.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
 	
 ${OBJECTDIR}/_ext/1234282992/system_interrupt.o: ../src/ASF/sam0/drivers/system/interrupt/system_interrupt.c  .generated_files/flags/Release/69e5f713f0117a442f6e6ad1d62dcd665dd0259e .generated_files/flags/Release/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1234282992" 
 	@${RM} ${OBJECTDIR}/_ext/1234282992/system_interrupt.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1234282992/system_interrupt.o 
-	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1234282992/system_interrupt.o.d" -o ${OBJECTDIR}/_ext/1234282992/system_interrupt.o ../src/ASF/sam0/drivers/system/interrupt/system_interrupt.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../../kernel" -I "../../port/arm_cm0_gcc" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1234282992/system_interrupt.o.d" -o ${OBJECTDIR}/_ext/1234282992/system_interrupt.o ../src/ASF/sam0/drivers/system/interrupt/system_interrupt.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
 	
 ${OBJECTDIR}/_ext/980481618/pinmux.o: ../src/ASF/sam0/drivers/system/pinmux/pinmux.c  .generated_files/flags/Release/16943547b4a704947c4be3cfeefd3737eba1d5b7 .generated_files/flags/Release/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/980481618" 
 	@${RM} ${OBJECTDIR}/_ext/980481618/pinmux.o.d 
 	@${RM} ${OBJECTDIR}/_ext/980481618/pinmux.o 
-	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/980481618/pinmux.o.d" -o ${OBJECTDIR}/_ext/980481618/pinmux.o ../src/ASF/sam0/drivers/system/pinmux/pinmux.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../../kernel" -I "../../port/arm_cm0_gcc" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/980481618/pinmux.o.d" -o ${OBJECTDIR}/_ext/980481618/pinmux.o ../src/ASF/sam0/drivers/system/pinmux/pinmux.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
 	
 ${OBJECTDIR}/_ext/227780132/system.o: ../src/ASF/sam0/drivers/system/system.c  .generated_files/flags/Release/372ffbd42c64c46201efd0db68f097fe57ba5597 .generated_files/flags/Release/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/227780132" 
 	@${RM} ${OBJECTDIR}/_ext/227780132/system.o.d 
 	@${RM} ${OBJECTDIR}/_ext/227780132/system.o 
-	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/227780132/system.o.d" -o ${OBJECTDIR}/_ext/227780132/system.o ../src/ASF/sam0/drivers/system/system.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../../kernel" -I "../../port/arm_cm0_gcc" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/227780132/system.o.d" -o ${OBJECTDIR}/_ext/227780132/system.o ../src/ASF/sam0/drivers/system/system.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
 	
 ${OBJECTDIR}/_ext/386045837/startup_samr21.o: ../src/ASF/sam0/utils/cmsis/samr21/source/gcc/startup_samr21.c  .generated_files/flags/Release/11cf3d7cd5d80a307bbb8677e3a1f0bedbda346a .generated_files/flags/Release/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/386045837" 
 	@${RM} ${OBJECTDIR}/_ext/386045837/startup_samr21.o.d 
 	@${RM} ${OBJECTDIR}/_ext/386045837/startup_samr21.o 
-	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/386045837/startup_samr21.o.d" -o ${OBJECTDIR}/_ext/386045837/startup_samr21.o ../src/ASF/sam0/utils/cmsis/samr21/source/gcc/startup_samr21.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../../kernel" -I "../../port/arm_cm0_gcc" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/386045837/startup_samr21.o.d" -o ${OBJECTDIR}/_ext/386045837/startup_samr21.o ../src/ASF/sam0/utils/cmsis/samr21/source/gcc/startup_samr21.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
 	
 ${OBJECTDIR}/_ext/2084470165/system_samr21.o: ../src/ASF/sam0/utils/cmsis/samr21/source/system_samr21.c  .generated_files/flags/Release/6d90fd0a9ecee9680bd792031b8ce6d4d31508ea .generated_files/flags/Release/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/2084470165" 
 	@${RM} ${OBJECTDIR}/_ext/2084470165/system_samr21.o.d 
 	@${RM} ${OBJECTDIR}/_ext/2084470165/system_samr21.o 
-	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/2084470165/system_samr21.o.d" -o ${OBJECTDIR}/_ext/2084470165/system_samr21.o ../src/ASF/sam0/utils/cmsis/samr21/source/system_samr21.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../../kernel" -I "../../port/arm_cm0_gcc" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/2084470165/system_samr21.o.d" -o ${OBJECTDIR}/_ext/2084470165/system_samr21.o ../src/ASF/sam0/utils/cmsis/samr21/source/system_samr21.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
 	
 ${OBJECTDIR}/_ext/1284275751/syscalls.o: ../src/ASF/sam0/utils/syscalls/gcc/syscalls.c  .generated_files/flags/Release/63caab9de6842f26892cd1c859460f886c24d8fb .generated_files/flags/Release/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1284275751" 
 	@${RM} ${OBJECTDIR}/_ext/1284275751/syscalls.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1284275751/syscalls.o 
-	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1284275751/syscalls.o.d" -o ${OBJECTDIR}/_ext/1284275751/syscalls.o ../src/ASF/sam0/utils/syscalls/gcc/syscalls.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../../kernel" -I "../../port/arm_cm0_gcc" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1284275751/syscalls.o.d" -o ${OBJECTDIR}/_ext/1284275751/syscalls.o ../src/ASF/sam0/utils/syscalls/gcc/syscalls.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
 	
-${OBJECTDIR}/_ext/1360937237/cpu-port.o: ../src/cpu-port.c  .generated_files/flags/Release/8e1a07d9ae2b5704ace17c45c9a213ad4660e2cd .generated_files/flags/Release/da39a3ee5e6b4b0d3255bfef95601890afd80709
-	@${MKDIR} "${OBJECTDIR}/_ext/1360937237" 
-	@${RM} ${OBJECTDIR}/_ext/1360937237/cpu-port.o.d 
-	@${RM} ${OBJECTDIR}/_ext/1360937237/cpu-port.o 
-	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1360937237/cpu-port.o.d" -o ${OBJECTDIR}/_ext/1360937237/cpu-port.o ../src/cpu-port.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
+${OBJECTDIR}/_ext/690257283/cpu-port.o: ../../port/arm_cm0_gcc/cpu-port.c  .generated_files/flags/Release/8e1a07d9ae2b5704ace17c45c9a213ad4660e2cd .generated_files/flags/Release/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/690257283" 
+	@${RM} ${OBJECTDIR}/_ext/690257283/cpu-port.o.d 
+	@${RM} ${OBJECTDIR}/_ext/690257283/cpu-port.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../../kernel" -I "../../port/arm_cm0_gcc" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/690257283/cpu-port.o.d" -o ${OBJECTDIR}/_ext/690257283/cpu-port.o ../../port/arm_cm0_gcc/cpu-port.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
 	
-${OBJECTDIR}/_ext/1360937237/rtos.o: ../src/rtos.c  .generated_files/flags/Release/34bee0f0d0b08606082269e40c8f311fc45e875c .generated_files/flags/Release/da39a3ee5e6b4b0d3255bfef95601890afd80709
-	@${MKDIR} "${OBJECTDIR}/_ext/1360937237" 
-	@${RM} ${OBJECTDIR}/_ext/1360937237/rtos.o.d 
-	@${RM} ${OBJECTDIR}/_ext/1360937237/rtos.o 
-	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1360937237/rtos.o.d" -o ${OBJECTDIR}/_ext/1360937237/rtos.o ../src/rtos.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
+${OBJECTDIR}/_ext/1109276195/rtos.o: ../../kernel/rtos.c  .generated_files/flags/Release/34bee0f0d0b08606082269e40c8f311fc45e875c .generated_files/flags/Release/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1109276195" 
+	@${RM} ${OBJECTDIR}/_ext/1109276195/rtos.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1109276195/rtos.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../../kernel" -I "../../port/arm_cm0_gcc" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1109276195/rtos.o.d" -o ${OBJECTDIR}/_ext/1109276195/rtos.o ../../kernel/rtos.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
 	
 ${OBJECTDIR}/_ext/1360937237/main.o: ../src/main.c  .generated_files/flags/Release/7eaf3b58e2d7f63fde68214500290f6ff02476b3 .generated_files/flags/Release/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1360937237" 
 	@${RM} ${OBJECTDIR}/_ext/1360937237/main.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1360937237/main.o 
-	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1360937237/main.o.d" -o ${OBJECTDIR}/_ext/1360937237/main.o ../src/main.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -mcpu=cortex-m0plus  -x c -c -D__$(MP_PROCESSOR_OPTION)__  -mthumb   -Os -ffunction-sections -mlong-calls -DNDEBUG -D__SAMR21G18A__ -DBOARD=SAMR21_XPLAINED_PRO -DARM_MATH_CM0PLUS=true -I "../src/ASF/common/boards" -I "../src/ASF/sam0/utils" -I "../src/ASF/sam0/utils/header_files" -I "../src/ASF/sam0/utils/preprocessor" -I "../src/ASF/thirdparty/CMSIS/Include" -I "../src/ASF/thirdparty/CMSIS/Lib/GCC" -I "../src/ASF/common/utils" -I "../src/ASF/sam0/utils/cmsis/samr21/include" -I "../src/ASF/sam0/utils/cmsis/samr21/source" -I "../src/ASF/sam0/drivers/port" -I "../src/ASF/sam0/drivers/system/pinmux" -I "../src/ASF/sam0/drivers/system" -I "../src/ASF/sam0/drivers/system/clock/clock_samd21_r21_da_ha1" -I "../src/ASF/sam0/drivers/system/clock" -I "../src/ASF/sam0/drivers/system/interrupt" -I "../src/ASF/sam0/drivers/system/interrupt/system_interrupt_samr21" -I "../src/ASF/sam0/drivers/system/power" -I "../src/ASF/sam0/drivers/system/power/power_sam_d_r_h" -I "../src/ASF/sam0/drivers/system/reset" -I "../src/ASF/sam0/drivers/system/reset/reset_sam_d_r_h" -I "../src/ASF/sam0/boards" -I "../src/ASF/sam0/boards/samr21_xplained_pro" -I "../src" -I "../../kernel" -I "../../port/arm_cm0_gcc" -I "../src/config" -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1360937237/main.o.d" -o ${OBJECTDIR}/_ext/1360937237/main.o ../src/main.c  -DXPRJ_Release=$(CND_CONF)  $(COMPARISON_BUILD)  -pipe -fno-strict-aliasing -Wall -Wstrict-prototypes -Wmissing-prototypes -Werror-implicit-function-declaration -Wpointer-arith -std=gnu99 -ffunction-sections -fdata-sections -Wchar-subscripts -Wcomment -Wformat=2 -Wimplicit-int -Wmain -Wparentheses -Wsequence-point -Wreturn-type -Wswitch -Wtrigraphs -Wunused -Wuninitialized -Wunknown-pragmas -Wfloat-equal -Wundef -Wshadow -Wbad-function-cast -Wwrite-strings -Wsign-compare -Waggregate-return  -Wmissing-declarations -Wformat -Wmissing-format-attribute -Wno-deprecated-declarations -Wpacked -Wredundant-decls -Wnested-externs -Wlong-long -Wunreachable-code -Wcast-align --param max-inline-insns-single=500 -fdata-sections
 	
 endif
 
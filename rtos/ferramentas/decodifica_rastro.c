@@ -0,0 +1,314 @@
+/*
+ * decodifica_rastro.c
+ *
+ * Decodificador, no computador, do rastro do sistema multitarefas
+ * (cfg_RASTRO). Le a copia da memoria da variavel rastro (rastro_t,
+ * little-endian), feita pelo depurador, por exemplo no gdb:
+ *
+ *   dump binary value rastro.bin rastro
+ *
+ * ou gravada pela simulacao posix, e mostra a linha do tempo dos eventos e o
+ * histograma, por tarefa, da latencia entre ficar pronta e executar.
+ *
+ *   decodifica_rastro [-s] rastro.bin [nome da tarefa 1] [nome da tarefa 2] ...
+ *
+ *   -s   somente os histogramas, sem a linha do tempo
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* os mesmos valores de rtos.h */
+#define RASTRO_MAGICO				0x52545352
+#define RASTRO_TROCA				1
+#define RASTRO_PRONTA				2
+#define RASTRO_BLOQUEIA				3
+#define RASTRO_DESPERTA				4
+#define RASTRO_SEMAFORO_LIBERA		5
+#define RASTRO_SEMAFORO_AGUARDA		6
+
+#define TAM_CABECALHO		16
+#define TAM_REGISTRO		8
+#define MAX_TAREFAS			256
+
+/* faixas do histograma: [0,1), [1,2), [2,4), ... , [512,1024) e >= 1024 us */
+#define NUM_FAIXAS			12
+#define LARGURA_BARRA		40
+
+typedef struct
+{
+	uint32_t	ciclos;
+	uint8_t		evento;
+	uint8_t		tarefa;
+	uint16_t	dado;
+} registro_t;
+
+typedef struct
+{
+	uint32_t	amostras;
+	double		minimo;
+	double		maximo;
+	double		soma;
+	uint32_t	faixas[NUM_FAIXAS];
+} histograma_t;
+
+static const char *nomes_eventos[] =
+{
+	"?", "troca", "pronta", "bloqueia", "desperta", "sem libera", "sem aguarda"
+};
+
+static char **nomes_tarefas;
+static int numero_nomes;
+
+static uint32_t Le32(const uint8_t *p)
+{
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t Le16(const uint8_t *p)
+{
+	return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static const char *NomeTarefa(uint8_t tarefa)
+{
+	static char nome[16];
+
+	if(tarefa == 0)
+	{
+		return "-";
+	}
+	if(tarefa <= numero_nomes)
+	{
+		return nomes_tarefas[tarefa - 1];
+	}
+	snprintf(nome, sizeof(nome), "tarefa %u", tarefa);
+	return nome;
+}
+
+static const char *NomeEvento(uint8_t evento)
+{
+	if(evento < sizeof(nomes_eventos) / sizeof(nomes_eventos[0]))
+	{
+		return nomes_eventos[evento];
+	}
+	return "?";
+}
+
+static void MostraRegistro(double us, const registro_t *registro)
+{
+	printf("%12.3f  %-11s %-16s ", us, NomeEvento(registro->evento), NomeTarefa(registro->tarefa));
+
+	switch(registro->evento)
+	{
+		case RASTRO_TROCA:
+			printf("(saiu %s)", NomeTarefa((uint8_t)registro->dado));
+			break;
+		case RASTRO_PRONTA:
+		case RASTRO_BLOQUEIA:
+			printf("prioridade %u", registro->dado);
+			break;
+		case RASTRO_DESPERTA:
+			printf("marca %u", registro->dado);
+			break;
+		case RASTRO_SEMAFORO_LIBERA:
+		case RASTRO_SEMAFORO_AGUARDA:
+			printf("semaforo 0x%04x", registro->dado);
+			break;
+		default:
+			break;
+	}
+	printf("\n");
+}
+
+static void Acumula(histograma_t *histograma, double us)
+{
+	int faixa = 0;
+	double limite = 1.0;
+
+	while(faixa < NUM_FAIXAS - 1 && us >= limite)
+	{
+		faixa++;
+		limite *= 2;
+	}
+
+	if(histograma->amostras == 0 || us < histograma->minimo)
+	{
+		histograma->minimo = us;
+	}
+	if(us > histograma->maximo)
+	{
+		histograma->maximo = us;
+	}
+	histograma->amostras++;
+	histograma->soma += us;
+	histograma->faixas[faixa]++;
+}
+
+static void MostraHistograma(uint8_t tarefa, const histograma_t *histograma)
+{
+	uint32_t maior = 0;
+	int i, barra;
+	double inicio = 0, fim = 1;
+
+	printf("\nlatencia de %s: %lu amostras, min %.3f med %.3f max %.3f us\n",
+		NomeTarefa(tarefa), (unsigned long)histograma->amostras, histograma->minimo,
+		histograma->soma / histograma->amostras, histograma->maximo);
+
+	for(i = 0; i < NUM_FAIXAS; i++)
+	{
+		if(histograma->faixas[i] > maior)
+		{
+			maior = histograma->faixas[i];
+		}
+	}
+
+	for(i = 0; i < NUM_FAIXAS; i++)
+	{
+		if(i == NUM_FAIXAS - 1)
+		{
+			printf("  >= %4.0f us      %6lu ", inicio, (unsigned long)histograma->faixas[i]);
+		}else
+		{
+			printf("  %4.0f - %4.0f us  %6lu ", inicio, fim, (unsigned long)histograma->faixas[i]);
+		}
+		for(barra = 0; barra < (int)((uint64_t)histograma->faixas[i] * LARGURA_BARRA / maior); barra++)
+		{
+			printf("#");
+		}
+		printf("\n");
+		inicio = fim;
+		fim *= 2;
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	FILE *entrada;
+	uint8_t cabecalho[TAM_CABECALHO];
+	uint8_t bytes[TAM_REGISTRO];
+	registro_t *registros;
+	uint32_t ciclos_por_us, total, quantidade, primeiro, i;
+	uint16_t tamanho;
+	int somente_histogramas = 0;
+	int arg = 1;
+
+	/* instante em que cada tarefa ficou pronta (tem_pronta = 0: nao esta esperando executar) */
+	static histograma_t histogramas[MAX_TAREFAS];
+	static uint64_t pronta_em[MAX_TAREFAS];
+	static uint8_t tem_pronta[MAX_TAREFAS];
+	uint8_t atual = 0;
+	uint64_t tempo = 0;
+	uint32_t anterior = 0;
+
+	if(arg < argc && strcmp(argv[arg], "-s") == 0)
+	{
+		somente_histogramas = 1;
+		arg++;
+	}
+	if(arg >= argc)
+	{
+		fprintf(stderr, "uso: %s [-s] rastro.bin [nomes das tarefas 1, 2, ...]\n", argv[0]);
+		return 1;
+	}
+
+	entrada = fopen(argv[arg], "rb");
+	if(entrada == 0 || fread(cabecalho, TAM_CABECALHO, 1, entrada) != 1 ||
+		Le32(&cabecalho[0]) != RASTRO_MAGICO)
+	{
+		fprintf(stderr, "%s: nao e uma copia do rastro\n", argv[arg]);
+		return 1;
+	}
+	nomes_tarefas = &argv[arg + 1];
+	numero_nomes = argc - arg - 1;
+
+	ciclos_por_us = Le32(&cabecalho[4]);
+	total = Le32(&cabecalho[8]);
+	tamanho = Le16(&cabecalho[12]);
+	if(ciclos_por_us == 0)
+	{
+		ciclos_por_us = 1;
+	}
+
+	/* com o anel cheio, o registro mais antigo e o proximo a ser gravado */
+	quantidade = total < tamanho ? total : tamanho;
+	primeiro = total < tamanho ? 0 : total % tamanho;
+
+	registros = calloc(tamanho ? tamanho : 1, sizeof(registro_t));
+	for(i = 0; i < tamanho; i++)
+	{
+		if(fread(bytes, TAM_REGISTRO, 1, entrada) != 1)
+		{
+			fprintf(stderr, "%s: copia incompleta (%lu de %u registros)\n", argv[arg],
+				(unsigned long)i, tamanho);
+			return 1;
+		}
+		registros[i].ciclos = Le32(&bytes[0]);
+		registros[i].evento = bytes[4];
+		registros[i].tarefa = bytes[5];
+		registros[i].dado = Le16(&bytes[6]);
+	}
+	fclose(entrada);
+
+	printf("rastro: %lu eventos gravados, %lu no anel de %u, %lu ciclos/us\n",
+		(unsigned long)total, (unsigned long)quantidade, tamanho, (unsigned long)ciclos_por_us);
+	if(!somente_histogramas)
+	{
+		printf("\n   tempo (us)  evento      tarefa\n");
+	}
+
+	for(i = 0; i < quantidade; i++)
+	{
+		const registro_t *registro = &registros[(primeiro + i) % tamanho];
+		uint8_t tarefa = registro->tarefa;
+
+		/* o contador de ciclos de 32 bits pode dar a volta entre os registros */
+		if(i > 0)
+		{
+			tempo += (uint32_t)(registro->ciclos - anterior);
+		}
+		anterior = registro->ciclos;
+
+		if(!somente_histogramas)
+		{
+			MostraRegistro((double)tempo / ciclos_por_us, registro);
+		}
+
+		switch(registro->evento)
+		{
+			case RASTRO_TROCA:		/* fim da espera para executar */
+				if(tem_pronta[tarefa])
+				{
+					Acumula(&histogramas[tarefa], (double)(tempo - pronta_em[tarefa]) / ciclos_por_us);
+					tem_pronta[tarefa] = 0;
+				}
+				atual = tarefa;
+				break;
+			case RASTRO_PRONTA:		/* a tarefa atual, recolocada pela mudanca de prioridade, nao espera */
+				if(tarefa != atual && !tem_pronta[tarefa])
+				{
+					pronta_em[tarefa] = tempo;
+					tem_pronta[tarefa] = 1;
+				}
+				break;
+			case RASTRO_BLOQUEIA:	/* deixa de esperar pelo processador */
+				tem_pronta[tarefa] = 0;
+				break;
+			default:
+				break;
+		}
+	}
+
+	for(i = 1; i < MAX_TAREFAS; i++)
+	{
+		if(histogramas[i].amostras > 0)
+		{
+			MostraHistograma((uint8_t)i, &histogramas[i]);
+		}
+	}
+
+	free(registros);
+	return 0;
+}
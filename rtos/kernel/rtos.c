@@ -0,0 +1,2843 @@
+/*
+ * rtos.c
+ *
+ */ 
+
+#include "rtos.h"
+#include <string.h>
+
+/* variaveis do sistema multitarefas */
+uint8_t 	   tarefa_atual, proxima_tarefa;
+tcb_t   	   TCB[NUMERO_DE_TAREFAS+1];
+stackptr_t	   ponteiro_de_pilha;
+prioridade_t   Prioridades[PRIORIDADE_MAXIMA+1];   /* vetor com a primeira tarefa pronta de cada prioridade */
+SP_TYPECAST	   SP;
+
+/* regioes criticas aninhadas da tarefa atual */
+volatile uint32_t regiao_atomica = 0;
+
+/* variavel auxiliar para guardar o numero de marcas de tempo, com a parte
+   alta (numero de voltas do contador) para formar um contador de 64 bits */
+static tick_t contador_marcas = 0;
+static tick_t contador_marcas_alto = 0;
+
+static uint8_t numero_tarefas = 0;
+
+/* primeira tarefa da lista de espera por tempo (0 = lista vazia) */
+static uint8_t lista_espera = 0;
+
+/* numero de marcas de tempo omitidas pelo modo sem marcas (tickless) */
+static uint32_t marcas_omitidas = 0;
+
+/* grupos de eventos sinalizados, semaforos liberados e filas alteradas por 
+   interrupcao, processados na troca de contexto */
+static eventos_t *eventos_pendentes = 0;
+static semaforo_t *semaforos_pendentes = 0;
+static fila_t *filas_pendentes = 0;
+
+#define HA_PENDENTES_ISR()		(eventos_pendentes != 0 || semaforos_pendentes != 0 || \
+								 filas_pendentes != 0)
+
+/* 1 = proxima_tarefa ja foi escolhida no pedido da troca de contexto e vale
+   ate a troca; a marca de tempo, que acorda tarefas, desfaz a escolha */
+static uint8_t proxima_escolhida = 0;
+
+#if cfg_TEMPORIZADORES
+/* lista delta dos temporizadores ativos, ordenada pelo vencimento */
+static temporizador_t *lista_temporizadores = 0;
+
+static void AvancaTemporizadores(tick_t qtas_marcas);
+#endif
+
+/* contadores das trocas de contexto realizadas, evitadas e abreviadas */
+static uint32_t trocas_realizadas = 0;
+static uint32_t trocas_evitadas = 0;
+static uint32_t trocas_abreviadas = 0;
+
+#if cfg_MEDIDAS_REGIAO_ATOMICA
+/* maior tempo com as interrupcoes desabilitadas de cada servico */
+static regiao_medida_t regioes_medidas[cfg_SERVICOS_MEDIDOS];
+static uint8_t numero_regioes_medidas = 0;
+static uint32_t inicio_regiao;		/* entrada na regiao critica mais externa */
+#endif
+
+#if cfg_ESTATISTICAS
+/* inicio da execucao da tarefa atual, em ciclos (LeCiclos()) */
+static uint32_t inicio_execucao;
+#endif
+
+#if cfg_MEDIDAS_LATENCIA
+/* medidas de latencia, em ciclos da porta (LeCiclos()) */
+typedef struct
+{
+	uint32_t	minimo;
+	uint32_t	maximo;
+	uint32_t	amostras;
+	uint64_t	soma;
+} medida_latencia_t;
+
+static medida_latencia_t latencia_troca[NUMERO_DE_TAREFAS+1];
+static medida_latencia_t latencia_isr[NUMERO_DE_TAREFAS+1];
+
+/* anel com as amostras mais recentes */
+static amostra_latencia_t amostras_latencia[cfg_AMOSTRAS_LATENCIA];
+static uint16_t amostra_proxima = 0;
+static uint16_t amostra_quantidade = 0;
+
+static uint32_t inicio_troca;		/* entrada na rotina de troca de contexto */
+static uint32_t instante_isr;		/* chamada do servico pela interrupcao */
+static uint8_t  medindo_isr = 0;	/* 1 = tarefas prontas foram acordadas pela interrupcao */
+static uint8_t  tarefa_isr = 0;		/* tarefa acordada pela interrupcao, aguardando executar */
+
+/* as tarefas que ficam prontas durante um servico chamado por interrupcao 
+ * tem a latencia medida desde a chamada ate comecarem a executar */
+#define MEDIDA_ISR_INICIO()		instante_isr = LeCiclos(); tarefa_isr = 0; medindo_isr = 1;
+#define MEDIDA_ISR_FIM()		medindo_isr = 0;
+
+static void RegistraLatencia(medida_latencia_t *medida, uint8_t id_tarefa, uint8_t tipo, uint32_t ciclos);
+#else
+#define MEDIDA_ISR_INICIO()
+#define MEDIDA_ISR_FIM()
+#endif
+
+#if cfg_RASTRO
+/* rastro dos eventos do nucleo, gravado desde o inicio (ciclos_por_us e 
+   preenchido por IniciaMultitarefas, pois o clock pode ser lido do driver) */
+rastro_t rastro = {RASTRO_MAGICO, 0, 0, cfg_TAM_RASTRO, 1, 0, {{0, 0, 0, 0}}};
+
+/* grava um registro no anel; chamada dentro das regioes criticas */
+static void Rastreia(uint8_t evento, uint8_t id_tarefa, uint16_t dado)
+{
+	rastro_registro_t *registro;
+	
+	if(rastro.ativo)
+	{
+		registro = &rastro.registros[rastro.total++ & (cfg_TAM_RASTRO - 1)];
+		registro->ciclos = LeCiclos();
+		registro->evento = evento;
+		registro->tarefa = id_tarefa;
+		registro->dado = dado;
+	}
+}
+#define RASTRO(evento, tarefa, dado)	Rastreia((evento), (tarefa), (uint16_t)(dado))
+#else
+#define RASTRO(evento, tarefa, dado)
+#endif
+
+#if cfg_ORCAMENTOS
+/* anel com as perdas de prazo e os estouros de orcamento mais recentes */
+static ocorrencia_t ocorrencias[cfg_OCORRENCIAS];
+static uint16_t ocorrencia_proxima = 0;
+static uint16_t ocorrencia_quantidade = 0;
+#endif
+
+/* mapa de bits das prioridades prontas: o bit p de mapa_prontas[p/32]
+   fica em 1 enquanto houver alguma tarefa de prioridade p pronta para executar.
+   Com mais de 32 prioridades, mapa_grupos indica quais palavras do mapa
+   tem algum bit em 1 (ate 256 prioridades com dois niveis de busca) */
+#define NUMERO_DE_GRUPOS	((PRIORIDADE_MAXIMA / 32) + 1)
+
+static uint32_t mapa_prontas[NUMERO_DE_GRUPOS];
+#if NUMERO_DE_GRUPOS > 1
+static uint32_t mapa_grupos;
+#endif
+
+/* busca do bit mais significativo em 1 (count leading zeros) */
+#if !defined(PORT_CLZ) && defined(__GNUC__) && !defined(__ARM_ARCH_6M__)
+#define PORT_CLZ(x)		__builtin_clz(x)
+#endif
+
+#ifndef PORT_CLZ
+/* o Cortex-M0+ nao possui a instrucao CLZ, entao a busca usa uma tabela
+   com a posicao do bit mais significativo de cada valor de 8 bits */
+static const uint8_t tabela_bit_maior[256] =
+{
+	0, 0, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7
+};
+#endif
+
+/* retorna a posicao (0 a 31) do bit mais significativo em 1 do mapa,
+   que nao pode ser zero. Tempo constante, sem lacos */
+static uint8_t BitMaisSignificativo(uint32_t mapa)
+{
+#ifdef PORT_CLZ
+	return (uint8_t)(31 - PORT_CLZ(mapa));
+#else
+	if(mapa & 0xFFFF0000)
+	{
+		if(mapa & 0xFF000000)
+		{
+			return 24 + tabela_bit_maior[mapa >> 24];
+		}
+		return 16 + tabela_bit_maior[mapa >> 16];
+	}
+	if(mapa & 0x0000FF00)
+	{
+		return 8 + tabela_bit_maior[mapa >> 8];
+	}
+	return tabela_bit_maior[mapa];
+#endif
+}
+
+/* marca a prioridade como pronta no mapa de bits */
+static void MarcaPrioridadePronta(prioridade_t prioridade)
+{
+	mapa_prontas[prioridade >> 5] |= (1UL << (prioridade & 31));
+#if NUMERO_DE_GRUPOS > 1
+	mapa_grupos |= (1UL << (prioridade >> 5));
+#endif
+}
+
+/* retira a prioridade do mapa de bits */
+static void DesmarcaPrioridadePronta(prioridade_t prioridade)
+{
+	mapa_prontas[prioridade >> 5] &= ~(1UL << (prioridade & 31));
+#if NUMERO_DE_GRUPOS > 1
+	if(mapa_prontas[prioridade >> 5] == 0)
+	{
+		mapa_grupos &= ~(1UL << (prioridade >> 5));
+	}
+#endif
+}
+
+/* As tarefas prontas de mesma prioridade ficam em uma lista circular
+   duplamente encadeada pelos campos proxima_pronta/anterior_pronta do TCB.
+   Prioridades[p] guarda a tarefa do inicio da lista (0 = lista vazia),
+   que e a escolhida pelo escalonador. Insercao e remocao sao O(1). */
+
+#if cfg_EDF
+/* As tarefas EDF prontas ficam tambem em um heap binario ordenado pelo prazo
+   absoluto (heap_edf[1] tem o prazo mais proximo), com insercao e remocao
+   O(log n). A comparacao usa a diferenca com sinal, valida apos a volta do
+   contador de marcas. A fila de prontas do nivel cfg_PRIORIDADE_EDF continua
+   mantida para o mapa de bits */
+static uint8_t heap_edf[NUMERO_DE_TAREFAS+1];
+static uint8_t tamanho_heap_edf = 0;
+
+#define PRAZO_ANTES(a, b)	((int32_t)(TCB[a].prazo_absoluto - TCB[b].prazo_absoluto) < 0)
+
+static void HeapEDFColoca(uint8_t posicao, uint8_t id_tarefa)
+{
+	heap_edf[posicao] = id_tarefa;
+	TCB[id_tarefa].posicao_edf = posicao;
+}
+
+/* leva a tarefa da posicao em direcao a raiz ou as folhas ate a posicao do
+ * seu prazo */
+static void HeapEDFAjusta(uint8_t posicao)
+{
+	uint8_t tarefa = heap_edf[posicao];
+	uint8_t filho;
+	
+	while(posicao > 1 && PRAZO_ANTES(tarefa, heap_edf[posicao / 2]))
+	{
+		HeapEDFColoca(posicao, heap_edf[posicao / 2]);
+		posicao /= 2;
+	}
+	
+	while((filho = (uint8_t)(2 * posicao)) <= tamanho_heap_edf)
+	{
+		if(filho < tamanho_heap_edf && PRAZO_ANTES(heap_edf[filho + 1], heap_edf[filho]))
+		{
+			filho++;
+		}
+		if(!PRAZO_ANTES(heap_edf[filho], tarefa))
+		{
+			break;
+		}
+		HeapEDFColoca(posicao, heap_edf[filho]);
+		posicao = filho;
+	}
+	
+	HeapEDFColoca(posicao, tarefa);
+}
+
+static void HeapEDFInsere(uint8_t id_tarefa)
+{
+	HeapEDFColoca(++tamanho_heap_edf, id_tarefa);
+	HeapEDFAjusta(tamanho_heap_edf);
+}
+
+static void HeapEDFRemove(uint8_t id_tarefa)
+{
+	uint8_t posicao = TCB[id_tarefa].posicao_edf;
+	uint8_t ultima = heap_edf[tamanho_heap_edf--];
+	
+	TCB[id_tarefa].posicao_edf = 0;
+	if(ultima != id_tarefa)
+	{
+		HeapEDFColoca(posicao, ultima);
+		HeapEDFAjusta(posicao);
+	}
+}
+#endif
+
+/* coloca a tarefa no fim da fila de prontas da sua prioridade */
+static void TarefaPronta(uint8_t id_tarefa)
+{
+	prioridade_t prioridade = TCB[id_tarefa].prioridade;
+	uint8_t primeira = Prioridades[prioridade];
+	uint8_t ultima;
+
+	if(TCB[id_tarefa].estado == PRONTA)
+	{
+		return;		/* ja esta na fila de prontas */
+	}
+
+	TCB[id_tarefa].estado = PRONTA;
+	TCB[id_tarefa].fatia_restante = TCB[id_tarefa].quantum;
+	RASTRO(RASTRO_PRONTA, id_tarefa, prioridade);
+
+#if cfg_EDF
+	if(TCB[id_tarefa].periodo != 0 && prioridade == cfg_PRIORIDADE_EDF)
+	{
+		HeapEDFInsere(id_tarefa);
+	}
+#endif
+
+#if cfg_MEDIDAS_LATENCIA
+	/* guarda a tarefa de maior prioridade acordada pela interrupcao */
+	if(medindo_isr && (tarefa_isr == 0 || 
+		TCB[id_tarefa].prioridade > TCB[tarefa_isr].prioridade))
+	{
+		tarefa_isr = id_tarefa;
+	}
+#endif
+
+	if(primeira == 0)
+	{
+		TCB[id_tarefa].proxima_pronta = id_tarefa;
+		TCB[id_tarefa].anterior_pronta = id_tarefa;
+		Prioridades[prioridade] = id_tarefa;
+		MarcaPrioridadePronta(prioridade);
+	}else
+	{
+		ultima = TCB[primeira].anterior_pronta;
+		TCB[id_tarefa].proxima_pronta = primeira;
+		TCB[id_tarefa].anterior_pronta = ultima;
+		TCB[ultima].proxima_pronta = id_tarefa;
+		TCB[primeira].anterior_pronta = id_tarefa;
+	}
+}
+
+/* retira a tarefa da fila de prontas e a coloca em espera */
+static void TarefaBloqueia(uint8_t id_tarefa)
+{
+	prioridade_t prioridade = TCB[id_tarefa].prioridade;
+	uint8_t proxima = TCB[id_tarefa].proxima_pronta;
+	uint8_t anterior = TCB[id_tarefa].anterior_pronta;
+
+	if(TCB[id_tarefa].estado != PRONTA)
+	{
+		return;		/* ja esta fora da fila de prontas */
+	}
+
+	TCB[id_tarefa].estado = ESPERA;
+	RASTRO(RASTRO_BLOQUEIA, id_tarefa, prioridade);
+
+#if cfg_EDF
+	if(TCB[id_tarefa].posicao_edf != 0)
+	{
+		HeapEDFRemove(id_tarefa);
+	}
+#endif
+
+	if(proxima == id_tarefa)
+	{
+		/* era a unica tarefa pronta desta prioridade */
+		Prioridades[prioridade] = 0;
+		DesmarcaPrioridadePronta(prioridade);
+	}else
+	{
+		TCB[anterior].proxima_pronta = proxima;
+		TCB[proxima].anterior_pronta = anterior;
+		if(Prioridades[prioridade] == id_tarefa)
+		{
+			Prioridades[prioridade] = proxima;
+		}
+	}
+}
+
+/* As tarefas em espera por tempo ficam em uma lista ordenada pelo instante
+   de despertar (lista delta): o tempo_espera de cada tarefa e contado a
+   partir do despertar da tarefa anterior na lista. Assim, a cada marca de
+   tempo somente a primeira tarefa da lista e decrementada. */
+
+/* insere a tarefa na lista de espera para despertar daqui a qtas_marcas */
+static void InsereListaEspera(uint8_t id_tarefa, tick_t qtas_marcas)
+{
+	uint8_t anterior = 0;
+	uint8_t atual = lista_espera;
+
+	/* procura a posicao da tarefa, descontando os tempos das que despertam antes */
+	while(atual != 0 && TCB[atual].tempo_espera <= qtas_marcas)
+	{
+		qtas_marcas -= TCB[atual].tempo_espera;
+		anterior = atual;
+		atual = TCB[atual].proxima_espera;
+	}
+
+	TCB[id_tarefa].tempo_espera = qtas_marcas;
+	TCB[id_tarefa].proxima_espera = atual;
+	TCB[id_tarefa].anterior_espera = anterior;
+
+	if(atual != 0)
+	{
+		TCB[atual].tempo_espera -= qtas_marcas;
+		TCB[atual].anterior_espera = id_tarefa;
+	}
+
+	if(anterior != 0)
+	{
+		TCB[anterior].proxima_espera = id_tarefa;
+	}else
+	{
+		lista_espera = id_tarefa;
+	}
+}
+
+/* retira a tarefa da lista de espera, se ela estiver na lista */
+static void RemoveListaEspera(uint8_t id_tarefa)
+{
+	uint8_t proxima = TCB[id_tarefa].proxima_espera;
+	uint8_t anterior = TCB[id_tarefa].anterior_espera;
+
+	if(anterior == 0 && lista_espera != id_tarefa)
+	{
+		return;		/* nao esta na lista de espera */
+	}
+
+	if(proxima != 0)
+	{
+		/* o tempo restante passa para a proxima tarefa da lista */
+		TCB[proxima].tempo_espera += TCB[id_tarefa].tempo_espera;
+		TCB[proxima].anterior_espera = anterior;
+	}
+
+	if(anterior != 0)
+	{
+		TCB[anterior].proxima_espera = proxima;
+	}else
+	{
+		lista_espera = proxima;
+	}
+
+	TCB[id_tarefa].proxima_espera = 0;
+	TCB[id_tarefa].anterior_espera = 0;
+	TCB[id_tarefa].tempo_espera = 0;
+}
+
+/* As listas de bloqueio (semaforo, mutex) sao encadeadas pelo campo proxima_bloqueada 
+   do TCB e ficam ordenadas pela prioridade efetiva das tarefas, entao a 
+   tarefa de maior prioridade esperando e sempre a primeira da lista. 
+   Tarefas de mesma prioridade ficam na ordem de chegada. */
+
+/* insere a tarefa na lista de bloqueio, na posicao da sua prioridade */
+static void InsereListaBloqueio(lista_bloqueio_t *lista, uint8_t id_tarefa)
+{
+	uint8_t anterior = 0;
+	uint8_t atual = lista->primeira;
+
+	while(atual != 0 && TCB[atual].prioridade >= TCB[id_tarefa].prioridade)
+	{
+		anterior = atual;
+		atual = TCB[atual].proxima_bloqueada;
+	}
+
+	TCB[id_tarefa].proxima_bloqueada = atual;
+	TCB[id_tarefa].lista_bloqueio = lista;
+
+	if(anterior != 0)
+	{
+		TCB[anterior].proxima_bloqueada = id_tarefa;
+	}else
+	{
+		lista->primeira = id_tarefa;
+	}
+}
+
+/* retira a tarefa da lista de bloqueio em que ela esta */
+static void RemoveListaBloqueio(uint8_t id_tarefa)
+{
+	lista_bloqueio_t *lista = TCB[id_tarefa].lista_bloqueio;
+	uint8_t atual;
+
+	if(lista == 0)
+	{
+		return;		/* nao esta em nenhuma lista de bloqueio */
+	}
+
+	if(lista->primeira == id_tarefa)
+	{
+		lista->primeira = TCB[id_tarefa].proxima_bloqueada;
+	}else
+	{
+		atual = lista->primeira;
+		while(TCB[atual].proxima_bloqueada != id_tarefa)
+		{
+			atual = TCB[atual].proxima_bloqueada;
+		}
+		TCB[atual].proxima_bloqueada = TCB[id_tarefa].proxima_bloqueada;
+	}
+
+	TCB[id_tarefa].proxima_bloqueada = 0;
+	TCB[id_tarefa].lista_bloqueio = 0;
+}
+
+/* muda a prioridade efetiva da tarefa, reposicionando-a na fila de prontas 
+ * ou na lista de bloqueio em que ela estiver */
+static void MudaPrioridade(uint8_t id_tarefa, prioridade_t prioridade)
+{
+	lista_bloqueio_t *lista = TCB[id_tarefa].lista_bloqueio;
+
+	if(TCB[id_tarefa].prioridade == prioridade)
+	{
+		return;
+	}
+
+	if(TCB[id_tarefa].estado == PRONTA)
+	{
+		TarefaBloqueia(id_tarefa);
+		TCB[id_tarefa].prioridade = prioridade;
+		TarefaPronta(id_tarefa);
+	}else if(lista != 0)
+	{
+		RemoveListaBloqueio(id_tarefa);
+		TCB[id_tarefa].prioridade = prioridade;
+		InsereListaBloqueio(lista, id_tarefa);
+	}else
+	{
+		TCB[id_tarefa].prioridade = prioridade;
+	}
+}
+
+static prioridade_t PrioridadeEfetiva(uint8_t id_tarefa);
+
+#if cfg_ORCAMENTOS
+/* Orcamentos de execucao: a cada marca de tempo, a tarefa interrompida gasta
+   uma marca do seu orcamento. A ativacao termina quando a tarefa sai do
+   processador bloqueada ou chama TarefaEsperaAte/TarefaAguardaPeriodo; 
+   entao o consumo recomeca e a prioridade rebaixada volta ao normal */
+
+static void RegistraOcorrencia(uint8_t id_tarefa, uint8_t tipo)
+{
+	ocorrencia_t *ocorrencia = &ocorrencias[ocorrencia_proxima];
+	
+	ocorrencia->marca = contador_marcas;
+	ocorrencia->tarefa = id_tarefa;
+	ocorrencia->tipo = tipo;
+	
+	if(++ocorrencia_proxima >= cfg_OCORRENCIAS)
+	{
+		ocorrencia_proxima = 0;
+	}
+	if(ocorrencia_quantidade < cfg_OCORRENCIAS)
+	{
+		ocorrencia_quantidade++;
+	}
+}
+
+static void FimDaAtivacao(uint8_t id_tarefa)
+{
+	TCB[id_tarefa].consumo = 0;
+	if(TCB[id_tarefa].rebaixada)
+	{
+		TCB[id_tarefa].rebaixada = 0;
+		MudaPrioridade(id_tarefa, PrioridadeEfetiva(id_tarefa));
+	}
+}
+
+/* gasta uma marca do orcamento da tarefa e, na primeira marca alem do 
+ * orcamento, aplica a acao configurada. Retorna 1 se a tarefa perdeu o 
+ * processador */
+static uint8_t GastaOrcamento(uint8_t id_tarefa)
+{
+	tcb_t *tcb = &TCB[id_tarefa];
+	
+	if(tcb->consumo > tcb->orcamento || ++tcb->consumo <= tcb->orcamento)
+	{
+		return 0;		/* dentro do orcamento ou estouro ja tratado */
+	}
+	
+	tcb->estouros++;
+	RegistraOcorrencia(id_tarefa, OCORRENCIA_ORCAMENTO);
+	
+	switch(tcb->acao_orcamento)
+	{
+		case ORCAMENTO_REBAIXA:
+			tcb->rebaixada = 1;
+			MudaPrioridade(id_tarefa, PrioridadeEfetiva(id_tarefa));
+			return 1;
+		case ORCAMENTO_SUSPENDE:
+			TarefaBloqueia(id_tarefa);
+			return 1;
+		default:
+			return 0;
+	}
+}
+#endif
+
+#if cfg_EDF || cfg_ORCAMENTOS
+/* conta o trabalho da tarefa terminado depois do prazo */
+static void PerdaDePrazo(uint8_t id_tarefa)
+{
+	TCB[id_tarefa].perdas_prazo++;
+#if cfg_ORCAMENTOS
+	RegistraOcorrencia(id_tarefa, OCORRENCIA_PRAZO);
+#endif
+}
+#endif
+
+/* bloqueia a tarefa atual na lista de bloqueio do objeto e, se houver tempo 
+ * limite, tambem na lista de espera por tempo. A tarefa sai das duas listas 
+ * pelo que acontecer primeiro: liberacao do objeto ou fim do tempo */
+static void BloqueiaEmLista(lista_bloqueio_t *lista, tick_t qtas_marcas)
+{
+	TCB[tarefa_atual].resultado = SUCESSO;
+	TarefaBloqueia(tarefa_atual);					/* tarefa colocada na fila de espera */
+	InsereListaBloqueio(lista, tarefa_atual);		/* tarefa colocada na espera do objeto */
+	if(qtas_marcas != ESPERA_INFINITA)
+	{
+		InsereListaEspera(tarefa_atual, qtas_marcas);	/* tarefa colocada na espera por tempo */
+	}
+}
+
+/* acorda uma tarefa bloqueada porque o objeto foi liberado para ela */
+static void DesbloqueiaDaLista(uint8_t id_tarefa)
+{
+	RemoveListaBloqueio(id_tarefa);
+	RemoveListaEspera(id_tarefa);			/* cancela o tempo limite */
+	TCB[id_tarefa].resultado = SUCESSO;
+	TarefaPronta(id_tarefa);				/* tarefa colocada na fila de pronta */
+}
+
+/* termina a espera da tarefa sem que o objeto tenha sido liberado para ela 
+ * (fim do tempo ou TarefaContinua) e a coloca na fila de prontas */
+static void InterrompeEspera(uint8_t id_tarefa, resultado_t resultado)
+{
+	mutex_t *mutex = TCB[id_tarefa].mutex_aguardado;
+	uint8_t dono;
+	prioridade_t prioridade;
+
+	RemoveListaEspera(id_tarefa);
+	if(TCB[id_tarefa].lista_bloqueio != 0)
+	{
+		RemoveListaBloqueio(id_tarefa);
+		TCB[id_tarefa].resultado = resultado;
+	}
+	TCB[id_tarefa].mutex_aguardado = 0;
+
+	/* os donos da cadeia de mutexes perdem a prioridade herdada desta tarefa */
+	while(mutex != 0 && mutex->dono != 0)
+	{
+		dono = mutex->dono;
+		prioridade = PrioridadeEfetiva(dono);
+		if(prioridade == TCB[dono].prioridade)
+		{
+			break;
+		}
+		MudaPrioridade(dono, prioridade);
+		mutex = TCB[dono].mutex_aguardado;
+	}
+
+	TarefaPronta(id_tarefa);				/* tarefa colocada na fila de prontas */
+}
+
+/* codigo independente de hardware */
+/* funcao para realizar o escalonamento de tarefas por prioridades
+   que retorna a proxima tarefa que sera executada, isto e, aquela que
+   tem a maior prioridade e que esta pronta para executar.
+   A busca e feita no mapa de bits das prioridades prontas, entao o
+   tempo de escalonamento nao depende do numero de prioridades */
+
+uint8_t escalonador(void)
+{
+	uint8_t grupo = 0;
+	prioridade_t prioridade;
+
+#if NUMERO_DE_GRUPOS > 1
+	if(mapa_grupos == 0)
+	{
+		/* caso nenhuma esteja pronta para executar, retorna a de menor prioridade,
+		 a qual sempre deve estar pronta para executar */
+		return Prioridades[0];
+	}
+	grupo = BitMaisSignificativo(mapa_grupos);
+#else
+	if(mapa_prontas[0] == 0)
+	{
+		/* caso nenhuma esteja pronta para executar, retorna a de menor prioridade,
+		 a qual sempre deve estar pronta para executar */
+		return Prioridades[0];
+	}
+#endif
+
+	/* retorna aquela que tem a maior prioridade e que esta pronta para executar */
+	prioridade = (prioridade_t)((grupo << 5) + BitMaisSignificativo(mapa_prontas[grupo]));
+
+#if cfg_EDF
+	/* no nivel das tarefas EDF, a de prazo absoluto mais proximo */
+	if(prioridade == cfg_PRIORIDADE_EDF && tamanho_heap_edf > 0)
+	{
+		return heap_edf[1];
+	}
+#endif
+
+	return Prioridades[prioridade];
+}
+ 
+
+
+/* Os TCBs das tarefas terminadas ficam em uma lista de TCBs livres, 
+   encadeada pelo campo proxima_pronta, e sao reaproveitados pelas novas
+   tarefas. numero_tarefas e o maior numero de tarefa ja usado, entao as 
+   tarefas criadas na inicializacao recebem os numeros 1, 2, 3... na ordem */
+static uint8_t tcb_livre = 0;
+
+/* retorna um TCB livre (0 = nenhum), em tempo constante */
+static uint8_t AlocaTCB(void)
+{
+	uint8_t id_tarefa = tcb_livre;
+	
+	if(id_tarefa != 0)
+	{
+		tcb_livre = TCB[id_tarefa].proxima_pronta;
+	}else if(numero_tarefas < NUMERO_DE_TAREFAS)
+	{
+		id_tarefa = ++numero_tarefas;
+	}
+	
+	return id_tarefa;
+}
+
+#if cfg_TAREFAS_DINAMICAS
+/* conjunto de pilhas de tamanho fixo das tarefas dinamicas, sem malloc e 
+   sem fragmentacao: as pilhas livres ficam em uma lista encadeada pelos 
+   indices (mais 1) em proxima_pilha_livre, com alocacao e liberacao O(1) */
+static uint32_t pilhas_dinamicas[cfg_TAREFAS_DINAMICAS][cfg_TAM_PILHA_DINAMICA];
+static uint8_t proxima_pilha_livre[cfg_TAREFAS_DINAMICAS];
+static uint8_t pilha_livre = 0;			/* primeira pilha livre mais 1 (0 = nenhuma) */
+static uint8_t pilhas_usadas = 0;		/* pilhas ja usadas alguma vez */
+
+static stackptr_t AlocaPilha(void)
+{
+	uint8_t indice;
+	
+	if(pilha_livre != 0)
+	{
+		indice = pilha_livre - 1;
+		pilha_livre = proxima_pilha_livre[indice];
+	}else if(pilhas_usadas < cfg_TAREFAS_DINAMICAS)
+	{
+		indice = pilhas_usadas++;
+	}else
+	{
+		return 0;
+	}
+	
+	return pilhas_dinamicas[indice];
+}
+
+/* devolve a pilha ao conjunto, se ela for do conjunto */
+static void LiberaPilha(stackptr_t pilha)
+{
+	uint8_t indice;
+	
+	if(pilha < pilhas_dinamicas[0] || pilha >= pilhas_dinamicas[cfg_TAREFAS_DINAMICAS])
+	{
+		return;		/* pilha fornecida pela aplicacao */
+	}
+	
+	indice = (uint8_t)((pilha - pilhas_dinamicas[0]) / cfg_TAM_PILHA_DINAMICA);
+	proxima_pilha_livre[indice] = pilha_livre;
+	pilha_livre = indice + 1;
+}
+#else
+#define LiberaPilha(pilha)
+#endif
+
+/*********************************************/
+/* cria a tarefa; periodo != 0 somente para as tarefas EDF */
+static uint8_t NovaTarefa(tarefa_t p, const char * nome,
+stackptr_t pilha, uint16_t tamanho, prioridade_t prioridade, tick_t periodo, tick_t prazo)
+{
+	uint8_t id_tarefa;
+	stackptr_t contexto;
+	uint16_t i;
+	
+	if(tamanho < TAM_MINIMO_PILHA)
+	{
+		return 0;
+	}
+	
+	/* preenche a pilha com o padrao, para a marca de agua e o estouro */
+	for(i = 0; i < tamanho; i++)
+	{
+		pilha[i] = PADRAO_PILHA;
+	}
+	
+	contexto = CriaContexto(p, pilha + tamanho);
+	
+	REG_ATOMICA_INICIO();
+	
+	id_tarefa = AlocaTCB();
+	if(id_tarefa == 0)
+	{
+		REG_ATOMICA_FIM();
+		return 0;
+	}
+
+	/* guardar os dados no bloco de controle da tarefa (TCB), que pode ter 
+	 * sido de uma tarefa terminada */
+	memset(&TCB[id_tarefa], 0, sizeof(tcb_t));
+	TCB[id_tarefa].nome = nome;
+	TCB[id_tarefa].stack_pointer = contexto;
+	TCB[id_tarefa].pilha = pilha;
+	TCB[id_tarefa].tamanho_pilha = tamanho;
+	TCB[id_tarefa].estado = ESPERA;
+	TCB[id_tarefa].prioridade = prioridade;
+	TCB[id_tarefa].prioridade_base = prioridade;
+	TCB[id_tarefa].quantum = cfg_QUANTUM_MARCAS;
+#if cfg_EDF
+	/* a primeira ativacao e liberada agora */
+	TCB[id_tarefa].periodo = periodo;
+	TCB[id_tarefa].prazo = prazo;
+	TCB[id_tarefa].liberacao = contador_marcas;
+	TCB[id_tarefa].prazo_absoluto = contador_marcas + prazo;
+#else
+	(void)periodo;
+	(void)prazo;
+#endif
+	  
+	/* coloca a tarefa na fila de prontas da sua prioridade, 
+	 * junto com as demais tarefas de mesma prioridade */
+	TarefaPronta(id_tarefa);
+	
+	if(tarefa_atual != 0)
+	{
+		TrocaContextoSeNecessario();	/* sistema ja iniciado */
+	}
+	
+	REG_ATOMICA_FIM();
+	
+	return id_tarefa;
+}
+
+/* cria a tarefa com a pilha fornecida e retorna o seu numero (0 = sem TCB
+   livre ou pilha pequena). Pode ser chamada antes de IniciaMultitarefas ou
+   por uma tarefa; neste caso, a nova tarefa executa logo se tiver 
+   prioridade maior */
+uint8_t CriaTarefa(tarefa_t p, const char * nome,
+stackptr_t pilha, uint16_t tamanho, prioridade_t prioridade)
+{
+	return NovaTarefa(p, nome, pilha, tamanho, prioridade, 0, 0);
+}
+
+#if cfg_EDF
+/* cria uma tarefa periodica escalonada pelo prazo mais proximo (EDF), no 
+   nivel de prioridade cfg_PRIORIDADE_EDF. Prazo relativo a cada liberacao;
+   prazo 0 = prazo igual ao periodo. Cada ativacao termina com 
+   TarefaAguardaPeriodo */
+uint8_t CriaTarefaEDF(tarefa_t p, const char * nome, stackptr_t pilha, uint16_t tamanho, 
+tick_t periodo, tick_t prazo)
+{
+	if(periodo == 0)
+	{
+		return 0;
+	}
+	if(prazo == 0)
+	{
+		prazo = periodo;
+	}
+	return NovaTarefa(p, nome, pilha, tamanho, cfg_PRIORIDADE_EDF, periodo, prazo);
+}
+
+/* termina a ativacao atual da tarefa EDF: conta a perda do prazo, se houve, 
+   e espera a proxima liberacao. Se a proxima liberacao ja passou (atraso), 
+   a tarefa continua pronta com o novo prazo */
+void TarefaAguardaPeriodo(void)
+{
+	tick_t agora;
+	
+	REG_ATOMICA_INICIO();
+	
+#if cfg_ORCAMENTOS
+	FimDaAtivacao(tarefa_atual);
+#endif
+	
+	if(TCB[tarefa_atual].periodo != 0)
+	{
+		agora = contador_marcas;
+		if((int32_t)(agora - TCB[tarefa_atual].prazo_absoluto) > 0)
+		{
+			PerdaDePrazo(tarefa_atual);
+		}
+		
+		TarefaBloqueia(tarefa_atual);
+		TCB[tarefa_atual].liberacao += TCB[tarefa_atual].periodo;
+		TCB[tarefa_atual].prazo_absoluto = TCB[tarefa_atual].liberacao + TCB[tarefa_atual].prazo;
+		
+		if((int32_t)(TCB[tarefa_atual].liberacao - agora) > 0)
+		{
+			InsereListaEspera(tarefa_atual, TCB[tarefa_atual].liberacao - agora);
+			TrocaContexto();
+		}else
+		{
+			TarefaPronta(tarefa_atual);
+			TrocaContextoSeNecessario();
+		}
+	}
+	
+	REG_ATOMICA_FIM();
+}
+#endif
+
+#if cfg_EDF || cfg_ORCAMENTOS
+/* quantidade de trabalhos da tarefa que terminaram depois do prazo: 
+   ativacoes EDF e, com cfg_ORCAMENTOS, periodos de TarefaEsperaAte */
+uint32_t TarefaPerdasDePrazo(uint8_t id_tarefa)
+{
+	uint32_t perdas;
+	
+	REG_ATOMICA_INICIO();
+	perdas = TCB[id_tarefa].perdas_prazo;
+	REG_ATOMICA_FIM();
+	
+	return perdas;
+}
+#endif
+
+#if cfg_TAREFAS_DINAMICAS
+/* cria a tarefa com uma pilha do conjunto de tarefas dinamicas, devolvida
+   quando a tarefa termina. Retorna o numero da tarefa (0 = sem pilha ou 
+   TCB livre) */
+uint8_t CriaTarefaDinamica(tarefa_t p, const char * nome, prioridade_t prioridade)
+{
+	stackptr_t pilha;
+	uint8_t id_tarefa;
+	
+	REG_ATOMICA_INICIO();
+	pilha = AlocaPilha();
+	REG_ATOMICA_FIM();
+	
+	if(pilha == 0)
+	{
+		return 0;
+	}
+	
+	id_tarefa = CriaTarefa(p, nome, pilha, cfg_TAM_PILHA_DINAMICA, prioridade);
+	if(id_tarefa == 0)
+	{
+		REG_ATOMICA_INICIO();
+		LiberaPilha(pilha);
+		REG_ATOMICA_FIM();
+	}
+	
+	return id_tarefa;
+}
+#endif
+
+static void MutexesDaTarefaLibera(uint8_t id_tarefa);
+
+/* retira a tarefa de todas as listas, libera os seus mutexes e devolve o 
+ * TCB e a pilha. A tarefa atual continua executando ate a troca de contexto,
+ * que guarda o contexto na pilha ja liberada: nenhuma tarefa pode ser criada
+ * antes disso, pois as interrupcoes nao criam tarefas */
+static void ApagaTarefa(uint8_t id_tarefa)
+{
+	InterrompeEspera(id_tarefa, INTERROMPIDA);	/* sai das listas de espera e de bloqueio */
+	TarefaBloqueia(id_tarefa);					/* sai da fila de prontas */
+	MutexesDaTarefaLibera(id_tarefa);
+	
+	TCB[id_tarefa].estado = TERMINADA;
+	LiberaPilha(TCB[id_tarefa].pilha);
+	TCB[id_tarefa].proxima_pronta = tcb_livre;
+	tcb_livre = id_tarefa;
+}
+
+/* termina a tarefa atual. O retorno da funcao da tarefa tambem chega aqui,
+ * pelo endereco de retorno colocado por CriaContexto */
+void TarefaTermina(void)
+{
+	REG_ATOMICA_INICIO();
+	ApagaTarefa(tarefa_atual);
+	TROCA_CONTEXTO();			/* nao retorna */
+	REG_ATOMICA_FIM();
+	
+	for(;;)
+	{
+	}
+}
+
+/* termina outra tarefa ou a tarefa atual. Retorna INVALIDA, sem terminar 
+ * nada, para um numero sem tarefa, uma tarefa ja terminada ou a tarefa 
+ * ociosa (prioridade 0), que o escalonador usa quando nenhuma outra esta 
+ * pronta. O numero da tarefa terminada passa a ser de outra tarefa quando 
+ * uma nova tarefa e criada */
+resultado_t TarefaApaga(uint8_t id_tarefa)
+{
+	resultado_t resultado = INVALIDA;
+	
+	REG_ATOMICA_INICIO();
+	if(id_tarefa != 0 && id_tarefa <= numero_tarefas && TCB[id_tarefa].estado != TERMINADA &&
+		TCB[id_tarefa].prioridade_base != 0)
+	{
+		if(id_tarefa == tarefa_atual)
+		{
+			TarefaTermina();			/* nao retorna */
+		}
+		ApagaTarefa(id_tarefa);
+		TrocaContextoSeNecessario();	/* um mutex liberado pode ter acordado outra tarefa */
+		resultado = SUCESSO;
+	}
+	REG_ATOMICA_FIM();
+	
+	return resultado;
+}
+
+/* Servicos do gerenciador de tarefas */
+void TarefaSuspende(uint8_t id_tarefa)
+{
+	REG_ATOMICA_INICIO();
+	TarefaBloqueia(id_tarefa); /* tarefa colocada em espera */
+	TrocaContextoSeNecessario(); 	/* troca de contexto se a tarefa atual foi suspensa */
+	REG_ATOMICA_FIM();
+}
+
+void TarefaContinua(uint8_t id_tarefa)
+{
+	REG_ATOMICA_INICIO();
+	if(TCB[id_tarefa].estado != TERMINADA)
+	{
+		InterrompeEspera(id_tarefa, INTERROMPIDA);	/* cancela uma eventual espera por tempo ou objeto */
+		TrocaContextoSeNecessario(); 			/* troca de contexto se a tarefa continuada tem prioridade maior */
+	}
+	REG_ATOMICA_FIM();
+}
+
+/* configura a fatia de tempo da tarefa no rodizio entre tarefas de mesma prioridade
+ * (modo ESCALONAMENTO_FATIA_TEMPO) */
+void TarefaQuantum(uint8_t id_tarefa, tick_t qtas_marcas)
+{
+	REG_ATOMICA_INICIO();
+	TCB[id_tarefa].quantum = qtas_marcas;
+	TCB[id_tarefa].fatia_restante = qtas_marcas;
+	REG_ATOMICA_FIM();
+}
+
+#if cfg_ORCAMENTOS
+/* configura o orcamento da tarefa, em marcas de execucao por ativacao
+ * (0 = sem limite), e a acao no estouro (ORCAMENTO_CONTA, ORCAMENTO_REBAIXA 
+ * ou ORCAMENTO_SUSPENDE) */
+void TarefaOrcamento(uint8_t id_tarefa, tick_t qtas_marcas, uint8_t acao)
+{
+	REG_ATOMICA_INICIO();
+	TCB[id_tarefa].orcamento = qtas_marcas;
+	TCB[id_tarefa].acao_orcamento = acao;
+	TCB[id_tarefa].consumo = 0;
+	REG_ATOMICA_FIM();
+}
+
+/* quantidade de ativacoes da tarefa que passaram do orcamento */
+uint32_t TarefaEstouros(uint8_t id_tarefa)
+{
+	uint32_t estouros;
+	
+	REG_ATOMICA_INICIO();
+	estouros = TCB[id_tarefa].estouros;
+	REG_ATOMICA_FIM();
+	
+	return estouros;
+}
+
+/* copia ate maximo ocorrencias recentes (perdas de prazo e estouros de 
+ * orcamento), da mais antiga para a mais nova, e retorna quantas foram 
+ * copiadas */
+uint16_t OcorrenciasRecentes(ocorrencia_t *destino, uint16_t maximo)
+{
+	uint16_t quantidade, posicao, i;
+	
+	REG_ATOMICA_INICIO();
+	
+	quantidade = ocorrencia_quantidade;
+	if(quantidade > maximo)
+	{
+		quantidade = maximo;
+	}
+	
+	posicao = (uint16_t)(ocorrencia_proxima + cfg_OCORRENCIAS - quantidade);
+	for(i = 0; i < quantidade; i++)
+	{
+		if(posicao >= cfg_OCORRENCIAS)
+		{
+			posicao -= cfg_OCORRENCIAS;
+		}
+		destino[i] = ocorrencias[posicao++];
+	}
+	
+	REG_ATOMICA_FIM();
+	
+	return quantidade;
+}
+#endif
+
+/* Espera ate o instante *ultimo_despertar + periodo e atualiza *ultimo_despertar,
+   para tarefas periodicas sem acumulo de atraso (drift). A comparacao com o 
+   contador de marcas usa a diferenca com sinal, valida mesmo apos a volta do 
+   contador. Se o instante ja passou, retorna sem esperar. */
+void TarefaEsperaAte(tick_t *ultimo_despertar, tick_t periodo)
+{
+	tick_t proximo_despertar;
+	tick_t qtas_marcas;
+
+	REG_ATOMICA_INICIO();			/* bloqueia interrupcoes */
+
+	proximo_despertar = *ultimo_despertar + periodo;
+	qtas_marcas = proximo_despertar - contador_marcas;
+	*ultimo_despertar = proximo_despertar;
+
+#if cfg_ORCAMENTOS
+	/* o trabalho do periodo terminou: perdeu o prazo se passou do proximo despertar */
+	FimDaAtivacao(tarefa_atual);
+	if((int32_t)qtas_marcas < 0)
+	{
+		PerdaDePrazo(tarefa_atual);
+	}
+#endif
+
+	if((int32_t)qtas_marcas > 0)
+	{
+		InsereListaEspera(tarefa_atual, qtas_marcas);	/* tarefa colocada na lista de espera por tempo */
+		TarefaBloqueia(tarefa_atual);					/* tarefa colocada na fila de espera */
+		TrocaContexto(); 	 /* tarefa atual solicita troca de contexto, so retorna quando ficar pronta novamente */
+	}
+
+	REG_ATOMICA_FIM();   /* desbloqueia interrupcoes */
+}
+
+/* retorna o menor numero de palavras livres que a pilha da tarefa ja teve 
+ * (marca de agua), isto e, as palavras do inicio da pilha que ainda tem o 
+ * padrao gravado na criacao */
+uint16_t TarefaPilhaLivre(uint8_t id_tarefa)
+{
+	uint16_t livres = 0;
+	
+	if(id_tarefa == 0 || id_tarefa > numero_tarefas)
+	{
+		return 0;
+	}
+	
+	while(livres < TCB[id_tarefa].tamanho_pilha && 
+		TCB[id_tarefa].pilha[livres] == PADRAO_PILHA)
+	{
+		livres++;
+	}
+	
+	return livres;
+}
+
+#if !cfg_ESTOURO_PILHA_USUARIO
+/* tarefa cuja pilha estourou, para a consulta pelo depurador */
+volatile uint8_t tarefa_estouro_pilha = 0;
+
+/* tratamento padrao do estouro de pilha: o sistema para, pois a memoria 
+ * vizinha da pilha pode estar corrompida. Com cfg_ESTOURO_PILHA_USUARIO, 
+ * a aplicacao fornece a sua EstouroDePilha() */
+void EstouroDePilha(uint8_t id_tarefa)
+{
+	REG_ATOMICA_INICIO();
+	tarefa_estouro_pilha = id_tarefa;
+	for(;;)
+	{
+	}
+}
+#endif
+
+/* retorna o contador de marcas de tempo (32 bits, da a volta a cada 2^32 marcas) */
+tick_t MarcasDeTempo(void)
+{
+	return contador_marcas;		/* leitura de 32 bits e atomica */
+}
+
+/* retorna o contador de marcas de tempo de 64 bits */
+uint64_t MarcasDeTempo64(void)
+{
+	uint64_t marcas;
+
+	REG_ATOMICA_INICIO();
+	marcas = ((uint64_t)contador_marcas_alto << 32) | contador_marcas;
+	REG_ATOMICA_FIM();
+
+	return marcas;
+}
+
+void TarefaEspera(tick_t qtas_marcas)
+{
+	if(qtas_marcas > 0)  //** so valores maiores que 0 */
+	{
+		REG_ATOMICA_INICIO();			/* bloqueia interrupcoes */
+		InsereListaEspera(tarefa_atual, qtas_marcas);	/* tarefa colocada na lista de espera por tempo */
+		TarefaBloqueia(tarefa_atual);				/* tarefa colocada na fila de espera */
+		TrocaContexto(); 	 /* tarefa atual solicita troca de contexto, so retorna quando ficar pronta novamente */
+		REG_ATOMICA_FIM();   /* desbloqueia interrupcoes */
+	}
+}
+
+#if cfg_MODO_SEM_MARCA
+/* Modo sem marcas de tempo: quando somente a tarefa ociosa esta pronta, o
+   temporizador e programado para o proximo despertar da lista de espera e o 
+   processador dorme sem as marcas intermediarias. Deve ser chamada com as
+   interrupcoes bloqueadas, pela tarefa ociosa (tarefa_ociosa() ou a da 
+   aplicacao). */
+void DormeAteProximoDespertar(void)
+{
+	tick_t qtas_marcas = 0;		/* 0 = nenhuma tarefa em espera por tempo */
+	tick_t omitidas;
+
+	/* a tarefa ociosa deve ser a unica pronta para executar */
+	if(escalonador() != tarefa_atual || TCB[tarefa_atual].proxima_pronta != tarefa_atual)
+	{
+		return;
+	}
+
+	if(lista_espera != 0)
+	{
+		qtas_marcas = TCB[lista_espera].tempo_espera;
+	}
+#if cfg_TEMPORIZADORES
+	/* o vencimento do primeiro temporizador tambem acorda o processador */
+	if(lista_temporizadores != 0 && 
+		(qtas_marcas == 0 || lista_temporizadores->tempo < qtas_marcas))
+	{
+		qtas_marcas = lista_temporizadores->tempo;
+	}
+#endif
+	if(qtas_marcas != 0 && qtas_marcas < 2)
+	{
+		return;		/* nao ha marcas para omitir */
+	}
+
+	/* dorme e corrige o contador de marcas com as marcas que passaram */
+	omitidas = DormeSemMarcaDeTempo(qtas_marcas);
+	if(omitidas > 0)
+	{
+		AvancaMarcasDeTempo(omitidas);
+		marcas_omitidas += omitidas;
+	}
+}
+#endif
+
+/* retorna quantas marcas de tempo foram omitidas pelo modo sem marcas */
+uint32_t MarcasDeTempoOmitidas(void)
+{
+	uint32_t omitidas;
+
+	REG_ATOMICA_INICIO();
+	omitidas = marcas_omitidas;
+	REG_ATOMICA_FIM();
+
+	return omitidas;
+}
+
+/* Exemplo de tarefa ociosa */
+void tarefa_ociosa(void)
+{
+	
+	for(;;)
+	{		
+		#if cfg_MODO_SEM_MARCA
+			REG_ATOMICA_INICIO();
+			DormeAteProximoDespertar();		/* dorme ate o proximo despertar */
+			REG_ATOMICA_FIM();
+		#endif
+		#if !cfg_PREEMPTIVO  /* para o uso como sistema cooperativo*/
+			REG_ATOMICA_INICIO();
+			TrocaContextoSeNecessario();	/* troca de contexto se outra tarefa esta pronta */
+			REG_ATOMICA_FIM();
+		#endif
+	}
+}
+
+
+#ifdef cfg_TABELA_DE_TAREFAS
+/* pilhas e tabela constante das tarefas, geradas da tabela de conf_rtos.h */
+#define TABELA_PILHA(tarefa, nome, tamanho, prioridade)		static uint32_t pilha_##tarefa[tamanho];
+#define TABELA_ENTRADA(tarefa, nome, tamanho, prioridade)	{tarefa, nome, pilha_##tarefa, tamanho, prioridade},
+
+cfg_TABELA_DE_TAREFAS(TABELA_PILHA)
+
+static const tarefa_tabela_t tabela_de_tarefas[] =
+{
+	cfg_TABELA_DE_TAREFAS(TABELA_ENTRADA)
+};
+
+/* cria as tarefas da tabela, na ordem, com os numeros ID_<funcao> */
+static void CriaTarefasDaTabela(void)
+{
+	const tarefa_tabela_t *entrada;
+	
+	for(entrada = tabela_de_tarefas; 
+		entrada < &tabela_de_tarefas[sizeof(tabela_de_tarefas) / sizeof(tabela_de_tarefas[0])]; 
+		entrada++)
+	{
+		CriaTarefa(entrada->tarefa, entrada->nome, entrada->pilha, entrada->tamanho, entrada->prioridade);
+	}
+}
+#endif
+
+void IniciaMultitarefas(void)
+{
+#ifdef cfg_TABELA_DE_TAREFAS
+	CriaTarefasDaTabela();
+#endif
+	
+	tarefa_atual = escalonador();
+#if cfg_RASTRO
+	rastro.ciclos_por_us = CICLOS_POR_US;
+#endif
+#if cfg_ESTATISTICAS
+	inicio_execucao = LeCiclos();
+	TCB[tarefa_atual].entradas = 1;
+	TCB[tarefa_atual].ultima_execucao = inicio_execucao;
+#endif
+	ponteiro_de_pilha = TCB[tarefa_atual].stack_pointer;
+	SP = (SP_TYPECAST) ponteiro_de_pilha;
+	GERA_INTERRUPCAO_SW();
+}
+
+static void ProcessaPendentesISR(void);
+
+void TrocaContextoDasTarefas(void)
+{
+	
+	/* guarda o valor antigo do stack pointer */
+	TCB[tarefa_atual].stack_pointer = (stackptr_t) SP;
+	
+#if cfg_VERIFICA_PILHA
+	/* a tarefa que sai nao pode ter passado do inicio da sua pilha: o ponteiro
+	 * de pilha deve estar dentro da area e a primeira palavra, intacta */
+	if(TCB[tarefa_atual].stack_pointer < TCB[tarefa_atual].pilha ||
+		TCB[tarefa_atual].pilha[0] != PADRAO_PILHA)
+	{
+		EstouroDePilha(tarefa_atual);
+	}
+#endif
+
+#if cfg_ORCAMENTOS
+	/* a tarefa que sai bloqueada termina a sua ativacao */
+	if(TCB[tarefa_atual].estado != PRONTA)
+	{
+		FimDaAtivacao(tarefa_atual);
+	}
+#endif
+	
+	/* eventos e semaforos sinalizados por interrupcao acordam as tarefas antes
+	 * do escalonamento; sem eles, a escolha feita no pedido da troca vale */
+	if(HA_PENDENTES_ISR())
+	{
+		ProcessaPendentesISR();
+		proxima_escolhida = 0;
+	}
+		
+	/* executa o escalonador */
+	if(!proxima_escolhida)
+	{
+		proxima_tarefa = escalonador();
+	}
+	proxima_escolhida = 0;
+	
+	if(proxima_tarefa != tarefa_atual)
+	{
+		trocas_realizadas++;
+		RASTRO(RASTRO_TROCA, proxima_tarefa, tarefa_atual);
+
+#if cfg_ESTATISTICAS
+		/* tempo de execucao da tarefa que sai e entrada da proxima tarefa */
+		{
+			uint32_t agora = LeCiclos();
+			TCB[tarefa_atual].tempo_execucao += (uint32_t)(agora - inicio_execucao);
+			TCB[proxima_tarefa].entradas++;
+			TCB[proxima_tarefa].ultima_execucao = agora;
+			inicio_execucao = agora;
+		}
+#endif
+
+#if cfg_MEDIDAS_LATENCIA
+		/* latencia desde a entrada na rotina de troca ate a selecao da nova tarefa
+		 * (a restauracao do contexto tem duracao constante e nao e medida) */
+		RegistraLatencia(&latencia_troca[proxima_tarefa], proxima_tarefa, 
+							LATENCIA_TROCA, LeCiclos() - inicio_troca);
+		
+		if(proxima_tarefa == tarefa_isr)
+		{
+			RegistraLatencia(&latencia_isr[proxima_tarefa], proxima_tarefa, 
+								LATENCIA_ISR, LeCiclos() - instante_isr);
+			tarefa_isr = 0;
+		}
+#endif
+	}
+		
+	/* seleciona a nova tarefa; o contador de regioes criticas e zero aqui,
+	   a tarefa que volta dentro de uma regiao o restaura da sua pilha */
+	tarefa_atual = proxima_tarefa;
+		
+	/* coloca um novo valor no stack pointer */
+	ponteiro_de_pilha = TCB[tarefa_atual].stack_pointer;
+		
+	SP = (SP_TYPECAST)ponteiro_de_pilha;
+
+}
+
+/* escolhe a proxima tarefa uma unica vez por troca: o resultado fica em 
+ * proxima_tarefa e e usado pela rotina de troca, a menos que uma interrupcao
+ * tenha deixado eventos pendentes. Retorna 1 se a troca e necessaria */
+static uint8_t EscolheProximaTarefa(void)
+{
+	if(HA_PENDENTES_ISR())
+	{
+		return 1;			/* a escolha so e feita apos processar os pendentes */
+	}
+	proxima_tarefa = escalonador();
+	proxima_escolhida = 1;
+	return proxima_tarefa != tarefa_atual;
+}
+
+/* chamada pela rotina de troca de contexto antes de salvar o contexto: 
+ * retorna 0 quando o escalonador mantem a tarefa atual e nao ha eventos 
+ * pendentes, e entao a rotina retorna sem salvar e restaurar o contexto.
+ * Com a escolha ja feita no pedido da troca, o escalonador nao e executado */
+uint8_t TrocaContextoNecessaria(void)
+{
+#if cfg_MEDIDAS_LATENCIA
+	inicio_troca = LeCiclos();
+#endif
+
+	if(proxima_escolhida || EscolheProximaTarefa())
+	{
+		return 1;
+	}
+	
+	proxima_escolhida = 0;
+	trocas_abreviadas++;
+	return 0;
+}
+
+/* solicita a troca de contexto somente se o escalonador escolher outra 
+ * tarefa, sem gerar a interrupcao de troca para a propria tarefa atual.
+ * Somente para as tarefas, com as interrupcoes bloqueadas: a troca acontece
+ * dentro da chamada */
+void TrocaContextoSeNecessario(void)
+{
+	if(EscolheProximaTarefa())
+	{
+		TROCA_CONTEXTO();
+	}else
+	{
+		proxima_escolhida = 0;
+		trocas_evitadas++;
+	}
+}
+
+/* versao para as interrupcoes (marca de tempo): somente solicita a troca, 
+ * feita no retorno da interrupcao, sem habilitar as interrupcoes */
+void TrocaContextoSeNecessarioISR(void)
+{
+	if(EscolheProximaTarefa())
+	{
+		PEDE_TROCA_CONTEXTO();
+	}else
+	{
+		proxima_escolhida = 0;
+		trocas_evitadas++;
+	}
+}
+
+/* retorna os contadores das trocas de contexto e a estimativa dos ciclos 
+ * economizados pelas trocas evitadas e abreviadas */
+void TrocasDeContexto(trocas_contexto_t *trocas)
+{
+	REG_ATOMICA_INICIO();
+	trocas->realizadas = trocas_realizadas;
+	trocas->evitadas = trocas_evitadas;
+	trocas->abreviadas = trocas_abreviadas;
+	REG_ATOMICA_FIM();
+	
+	trocas->ciclos_economizados = (uint64_t)trocas->evitadas * CICLOS_TROCA_CONTEXTO +
+									(uint64_t)trocas->abreviadas * CICLOS_SALVA_RESTAURA;
+}
+
+#if cfg_RASTRO
+/* esvazia o anel e volta a gravar o rastro */
+void RastroInicia(void)
+{
+	REG_ATOMICA_INICIO();
+	rastro.total = 0;
+	rastro.ativo = 1;
+	REG_ATOMICA_FIM();
+}
+
+/* para de gravar, guardando os ultimos cfg_TAM_RASTRO eventos (por exemplo,
+ * ao detectar uma falha, antes de copiar a memoria do rastro) */
+void RastroPara(void)
+{
+	REG_ATOMICA_INICIO();
+	rastro.ativo = 0;
+	REG_ATOMICA_FIM();
+}
+#endif
+/* avanca o contador de marcas e a lista de espera em varias marcas de uma vez,
+ * apos um periodo sem marcas de tempo */
+void AvancaMarcasDeTempo(tick_t qtas_marcas)
+{
+	uint8_t tarefa;
+
+	proxima_escolhida = 0;
+	contador_marcas += qtas_marcas;
+	if(contador_marcas < qtas_marcas)
+	{
+		++contador_marcas_alto;		/* contador deu a volta */
+	}
+
+#if cfg_TEMPORIZADORES
+	AvancaTemporizadores(qtas_marcas);
+#endif
+
+	while(lista_espera != 0 && qtas_marcas > 0)
+	{
+		if(TCB[lista_espera].tempo_espera > qtas_marcas)
+		{
+			TCB[lista_espera].tempo_espera -= qtas_marcas;
+			break;
+		}
+
+		qtas_marcas -= TCB[lista_espera].tempo_espera;
+		TCB[lista_espera].tempo_espera = 0;
+
+		/* coloca as tarefas cujo tempo terminou na fila de prontas para executar */
+		while(lista_espera != 0 && TCB[lista_espera].tempo_espera == 0)
+		{
+			tarefa = lista_espera;
+			RASTRO(RASTRO_DESPERTA, tarefa, contador_marcas);
+			InterrompeEspera(tarefa, TEMPO_ESGOTADO);
+		}
+	}
+}
+
+/* retorna 1 quando a fatia de tempo da tarefa atual termina e ha outra 
+ * tarefa pronta de mesma prioridade, isto e, quando o rodizio exige troca de 
+ * contexto (somente no modo ESCALONAMENTO_FATIA_TEMPO) */
+uint8_t ExecutaMarcaDeTempo(void)
+{
+	
+	uint8_t tarefa = 0;
+	uint8_t rodizio = 0;
+	
+	MEDIDA_ISR_INICIO();		/* latencia da marca de tempo ate a tarefa acordada */
+	
+	proxima_escolhida = 0;
+		
+	if(++contador_marcas == 0) /* incrementa contador de marcas de tempo */
+	{
+		++contador_marcas_alto;		/* contador deu a volta */
+	}
+	
+	/* A lista de espera guarda somente diferencas de tempo entre as tarefas,
+	 * sem instantes absolutos, entao a volta do contador nao afeta as esperas */
+	
+	/* somente a primeira tarefa da lista de espera e decrementada */
+	if(lista_espera != 0)
+	{
+		if(TCB[lista_espera].tempo_espera > 0)
+		{
+			TCB[lista_espera].tempo_espera--; /* decrementa tempo de espera */
+		}
+
+		/* coloca as tarefas cujo tempo terminou na fila de prontas para executar */
+		while(lista_espera != 0 && TCB[lista_espera].tempo_espera == 0)
+		{
+			tarefa = lista_espera;
+			RASTRO(RASTRO_DESPERTA, tarefa, contador_marcas);
+			InterrompeEspera(tarefa, TEMPO_ESGOTADO);
+		}
+	}
+
+#if cfg_TEMPORIZADORES
+	if(lista_temporizadores != 0)
+	{
+		AvancaTemporizadores(1);
+	}
+#endif
+
+#if cfg_ORCAMENTOS
+	/* a tarefa interrompida gasta o seu orcamento. No modo cooperativo, a 
+	 * tarefa rebaixada ou suspensa perde o processador mesmo sem ceder */
+	if(TCB[tarefa_atual].orcamento != 0 && TCB[tarefa_atual].estado == PRONTA)
+	{
+		if(GastaOrcamento(tarefa_atual) && !cfg_PREEMPTIVO)
+		{
+			TrocaContextoSeNecessarioISR();
+		}
+	}
+#endif
+
+#if cfg_MODO_ESCALONAMENTO == ESCALONAMENTO_FATIA_TEMPO
+	/* rodizio entre tarefas de mesma prioridade: quando a fatia de tempo
+	 * termina, a tarefa atual vai para o fim da fila de prontas */
+	if(TCB[tarefa_atual].estado == PRONTA && TCB[tarefa_atual].quantum > 0)
+	{
+		if(--TCB[tarefa_atual].fatia_restante == 0)
+		{
+			TCB[tarefa_atual].fatia_restante = TCB[tarefa_atual].quantum;
+
+			if(TCB[tarefa_atual].proxima_pronta != tarefa_atual &&
+				Prioridades[TCB[tarefa_atual].prioridade] == tarefa_atual)
+			{
+				Prioridades[TCB[tarefa_atual].prioridade] = TCB[tarefa_atual].proxima_pronta;
+				rodizio = 1;
+			}
+		}
+	}
+#endif
+
+	MEDIDA_ISR_FIM();
+
+	return rodizio;
+}
+
+/* Servicos de semaforos */
+
+/* libera o semaforo: acorda a tarefa de maior prioridade esperando ou 
+ * incrementa o contador. Retorna a tarefa acordada (0 = nenhuma) */
+static uint8_t SemaforoIncrementa(semaforo_t* sem)
+{
+	uint8_t tarefa = sem->esperando.primeira;
+	
+	RASTRO(RASTRO_SEMAFORO_LIBERA, tarefa, (uintptr_t)sem);
+	if(tarefa > 0)
+	{
+		DesbloqueiaDaLista(tarefa);				/* tarefa retirada da espera do semaforo */
+	}else
+	{
+		sem->contador++;
+	}
+	
+	return tarefa;
+}
+
+void SemaforoAguarda(semaforo_t* sem)
+{
+	(void)SemaforoAguardaTempo(sem, ESPERA_INFINITA);
+}
+
+/* aguarda o semaforo por no maximo qtas_marcas marcas de tempo 
+ * (0 = nao espera, ESPERA_INFINITA = sem limite) */
+resultado_t SemaforoAguardaTempo(semaforo_t* sem, tick_t qtas_marcas)
+{
+	resultado_t resultado = SUCESSO;
+	
+	REG_ATOMICA_INICIO();
+	
+	RASTRO(RASTRO_SEMAFORO_AGUARDA, tarefa_atual, (uintptr_t)sem);
+	if(sem->contador > 0)
+	{
+		sem->contador--;
+	}else if(qtas_marcas == 0)
+	{
+		resultado = TEMPO_ESGOTADO;				/* semaforo indisponivel e sem espera */
+	}else
+	{
+		BloqueiaEmLista(&sem->esperando, qtas_marcas);	/* tarefa colocada na espera do semaforo */
+		TROCA_CONTEXTO();						/* solicita troca de contexto, retorna com o semaforo ou sem tempo */
+		resultado = TCB[tarefa_atual].resultado;
+	}
+	
+	REG_ATOMICA_FIM();
+	
+	return resultado;
+}
+
+
+void SemaforoLibera(semaforo_t* sem)
+{
+	uint8_t tarefa;
+	
+	REG_ATOMICA_INICIO();
+	
+	/* tem alguma tarefa aguardando ? entao acorda a de maior prioridade */
+	tarefa = SemaforoIncrementa(sem);
+	
+	/* so troca de contexto se a tarefa acordada tem prioridade maior */
+	if(tarefa > 0 && TCB[tarefa].prioridade > TCB[tarefa_atual].prioridade)
+	{
+		TROCA_CONTEXTO();
+	}
+	
+	REG_ATOMICA_FIM();
+}
+
+/* versao para rotinas de interrupcao: a liberacao e guardada como pendente e
+ * processada na troca de contexto, fora da interrupcao. A interrupcao so 
+ * solicita a troca de contexto, sem mexer nas listas de tarefas, entao o seu
+ * tempo de execucao e pequeno e constante */
+void SemaforoLiberaISR(semaforo_t* sem)
+{
+	REG_ATOMICA_INICIO();
+	
+#if cfg_MEDIDAS_LATENCIA
+	if(!HA_PENDENTES_ISR())
+	{
+		instante_isr = LeCiclos();	/* primeira sinalizacao ainda nao processada */
+	}
+#endif
+	
+	if(sem->pendentes == 0)
+	{
+		sem->proximo_pendente = semaforos_pendentes;	/* semaforo colocado na lista de pendentes */
+		semaforos_pendentes = sem;
+	}
+	if(sem->pendentes < 0xFF)
+	{
+		sem->pendentes++;
+	}
+	
+	PEDE_TROCA_CONTEXTO();
+	
+	REG_ATOMICA_FIM();
+}
+
+/* Servicos de mutex com heranca de prioridade */
+
+/* heranca transitiva: o dono do mutex que a tarefa espera recebe a prioridade
+ * dela e, se esse dono tambem espera outro mutex, a heranca segue a cadeia */
+static void HerdaPrioridade(uint8_t id_tarefa)
+{
+	mutex_t *mutex = TCB[id_tarefa].mutex_aguardado;
+
+	while(mutex != 0 && mutex->dono != 0 && 
+		TCB[mutex->dono].prioridade < TCB[id_tarefa].prioridade)
+	{
+		MudaPrioridade(mutex->dono, TCB[id_tarefa].prioridade);
+		id_tarefa = mutex->dono;
+		mutex = TCB[id_tarefa].mutex_aguardado;
+	}
+}
+
+/* recalcula a prioridade efetiva da tarefa: a maior entre a sua prioridade 
+ * base e a das tarefas esperando pelos mutexes que ela ainda possui */
+static prioridade_t PrioridadeEfetiva(uint8_t id_tarefa)
+{
+	prioridade_t prioridade = TCB[id_tarefa].prioridade_base;
+	mutex_t *mutex = TCB[id_tarefa].mutexes;
+	uint8_t primeira;
+
+#if cfg_ORCAMENTOS
+	/* a tarefa rebaixada continua herdando a prioridade pelos mutexes */
+	if(TCB[id_tarefa].rebaixada && prioridade > cfg_PRIORIDADE_REBAIXADA)
+	{
+		prioridade = cfg_PRIORIDADE_REBAIXADA;
+	}
+#endif
+
+	while(mutex != 0)
+	{
+		primeira = mutex->esperando.primeira;
+		if(primeira != 0 && TCB[primeira].prioridade > prioridade)
+		{
+			prioridade = TCB[primeira].prioridade;
+		}
+		mutex = mutex->proximo;
+	}
+
+	return prioridade;
+}
+
+/* entrega o mutex para a tarefa, que passa a ser a dona */
+static void MutexEntrega(mutex_t* mutex, uint8_t id_tarefa)
+{
+	mutex->dono = id_tarefa;
+	mutex->recursao = 1;
+	mutex->proximo = TCB[id_tarefa].mutexes;
+	TCB[id_tarefa].mutexes = mutex;
+}
+
+void MutexTrava(mutex_t* mutex)
+{
+	(void)MutexTravaTempo(mutex, ESPERA_INFINITA);
+}
+
+/* trava o mutex esperando no maximo qtas_marcas marcas de tempo 
+ * (0 = nao espera, ESPERA_INFINITA = sem limite) */
+resultado_t MutexTravaTempo(mutex_t* mutex, tick_t qtas_marcas)
+{
+	resultado_t resultado = SUCESSO;
+	
+	REG_ATOMICA_INICIO();
+	
+	if(mutex->dono == 0)
+	{
+		MutexEntrega(mutex, tarefa_atual);		/* mutex livre */
+	}else if(mutex->dono == tarefa_atual)
+	{
+		mutex->recursao++;						/* travamento recursivo pelo dono */
+	}else if(qtas_marcas == 0)
+	{
+		resultado = TEMPO_ESGOTADO;				/* mutex ocupado e sem espera */
+	}else
+	{
+		TCB[tarefa_atual].mutex_aguardado = mutex;
+		BloqueiaEmLista(&mutex->esperando, qtas_marcas);	/* tarefa colocada na espera do mutex */
+		HerdaPrioridade(tarefa_atual);						/* dono herda a prioridade da tarefa */
+		TROCA_CONTEXTO();						/* solicita troca de contexto, retorna com o mutex ou sem tempo */
+		resultado = TCB[tarefa_atual].resultado;
+	}
+	
+	REG_ATOMICA_FIM();
+	
+	return resultado;
+}
+
+void MutexLibera(mutex_t* mutex)
+{
+	mutex_t **anterior;
+	uint8_t tarefa;
+	
+	REG_ATOMICA_INICIO();
+	
+	if(mutex->dono != tarefa_atual)
+	{
+		REG_ATOMICA_FIM();
+		return;			/* somente o dono pode liberar o mutex */
+	}
+	
+	if(--mutex->recursao > 0)
+	{
+		REG_ATOMICA_FIM();
+		return;			/* ainda travado pelo dono */
+	}
+	
+	/* retira o mutex da lista de mutexes do dono */
+	anterior = &TCB[tarefa_atual].mutexes;
+	while(*anterior != mutex)
+	{
+		anterior = &(*anterior)->proximo;
+	}
+	*anterior = mutex->proximo;
+	mutex->proximo = 0;
+	
+	/* entrega o mutex diretamente para a tarefa de maior prioridade esperando */
+	tarefa = mutex->esperando.primeira;
+	if(tarefa != 0)
+	{
+		TCB[tarefa].mutex_aguardado = 0;
+		MutexEntrega(mutex, tarefa);
+		DesbloqueiaDaLista(tarefa);		/* tarefa colocada na fila de pronta */
+	}else
+	{
+		mutex->dono = 0;
+	}
+	
+	/* o dono anterior perde a prioridade herdada por este mutex */
+	MudaPrioridade(tarefa_atual, PrioridadeEfetiva(tarefa_atual));
+	
+	TrocaContextoSeNecessario();
+	
+	REG_ATOMICA_FIM();
+}
+
+/* libera os mutexes da tarefa que termina, entregando cada um a tarefa de 
+ * maior prioridade que o espera */
+static void MutexesDaTarefaLibera(uint8_t id_tarefa)
+{
+	mutex_t *mutex;
+	uint8_t tarefa;
+	
+	while((mutex = TCB[id_tarefa].mutexes) != 0)
+	{
+		TCB[id_tarefa].mutexes = mutex->proximo;
+		mutex->proximo = 0;
+		
+		tarefa = mutex->esperando.primeira;
+		if(tarefa != 0)
+		{
+			TCB[tarefa].mutex_aguardado = 0;
+			MutexEntrega(mutex, tarefa);
+			DesbloqueiaDaLista(tarefa);		/* tarefa colocada na fila de pronta */
+		}else
+		{
+			mutex->dono = 0;
+		}
+	}
+}
+
+/* Servicos de fila de mensagens */
+
+/* As mensagens sao copiadas para a area da fila. Se uma tarefa ja espera
+ * na outra ponta, a mensagem e copiada diretamente entre as tarefas, sem
+ * passar pela fila. Mensagens grandes podem ser passadas por referencia com
+ * FilaEnviaPonteiro/FilaRecebePonteiro, em uma fila de mensagens do tamanho
+ * de um ponteiro. */
+
+void FilaCria(fila_t* fila, void* buffer, uint16_t tamanho, uint16_t capacidade)
+{
+	REG_ATOMICA_INICIO();
+	
+	fila->buffer = (uint8_t*)buffer;
+	fila->tamanho = tamanho;
+	fila->capacidade = capacidade;
+	fila->quantidade = 0;
+	fila->leitura = 0;
+	fila->receptores.primeira = 0;
+	fila->emissores.primeira = 0;
+	fila->pendente = 0;
+	fila->proximo_pendente = 0;
+	
+	REG_ATOMICA_FIM();
+}
+
+/* endereco da mensagem na posicao indicada da fila circular */
+static uint8_t* FilaPosicao(fila_t* fila, uint16_t posicao)
+{
+	if(posicao >= fila->capacidade)
+	{
+		posicao -= fila->capacidade;
+	}
+	return &fila->buffer[(uint32_t)posicao * fila->tamanho];
+}
+
+/* acorda a tarefa da lista e troca de contexto se ela tem prioridade maior */
+static void FilaAcorda(uint8_t tarefa)
+{
+	DesbloqueiaDaLista(tarefa);
+	
+	if(TCB[tarefa].prioridade > TCB[tarefa_atual].prioridade)
+	{
+		TROCA_CONTEXTO();
+	}
+}
+
+resultado_t FilaEnvia(fila_t* fila, const void* mensagem, tick_t qtas_marcas)
+{
+	resultado_t resultado = SUCESSO;
+	uint8_t tarefa;
+	
+	REG_ATOMICA_INICIO();
+	
+	/* com mensagens guardadas por interrupcao e ainda nao entregues, a nova
+	 * mensagem vai para o fim da fila, mantendo a ordem */
+	tarefa = fila->receptores.primeira;
+	if(tarefa != 0 && fila->quantidade == 0)
+	{	/* entrega direta para a tarefa de maior prioridade esperando mensagem */
+		memcpy(TCB[tarefa].mensagem, mensagem, fila->tamanho);
+		FilaAcorda(tarefa);
+	}else if(fila->quantidade < fila->capacidade)
+	{
+		memcpy(FilaPosicao(fila, fila->leitura + fila->quantidade), mensagem, fila->tamanho);
+		fila->quantidade++;
+	}else if(qtas_marcas == 0)
+	{
+		resultado = TEMPO_ESGOTADO;				/* fila cheia e sem espera */
+	}else
+	{
+		TCB[tarefa_atual].mensagem = (void*)mensagem;	/* copiada pela tarefa que abrir espaco */
+		BloqueiaEmLista(&fila->emissores, qtas_marcas);	/* tarefa colocada na espera por espaco */
+		TROCA_CONTEXTO();						/* solicita troca de contexto, retorna com a mensagem enviada ou sem tempo */
+		resultado = TCB[tarefa_atual].resultado;
+	}
+	
+	REG_ATOMICA_FIM();
+	
+	return resultado;
+}
+
+resultado_t FilaRecebe(fila_t* fila, void* mensagem, tick_t qtas_marcas)
+{
+	resultado_t resultado = SUCESSO;
+	uint8_t tarefa;
+	
+	REG_ATOMICA_INICIO();
+	
+	if(fila->quantidade > 0)
+	{
+		memcpy(mensagem, FilaPosicao(fila, fila->leitura), fila->tamanho);
+		fila->leitura = (fila->leitura + 1 < fila->capacidade) ? fila->leitura + 1 : 0;
+		fila->quantidade--;
+		
+		/* o espaco liberado vai para a tarefa de maior prioridade esperando para enviar */
+		tarefa = fila->emissores.primeira;
+		if(tarefa != 0)
+		{
+			memcpy(FilaPosicao(fila, fila->leitura + fila->quantidade), TCB[tarefa].mensagem, fila->tamanho);
+			fila->quantidade++;
+			FilaAcorda(tarefa);
+		}
+	}else if(fila->emissores.primeira != 0)
+	{	/* fila sem area de armazenamento (capacidade 0): entrega direta do emissor */
+		tarefa = fila->emissores.primeira;
+		memcpy(mensagem, TCB[tarefa].mensagem, fila->tamanho);
+		FilaAcorda(tarefa);
+	}else if(qtas_marcas == 0)
+	{
+		resultado = TEMPO_ESGOTADO;				/* fila vazia e sem espera */
+	}else
+	{
+		TCB[tarefa_atual].mensagem = mensagem;	/* preenchida pela tarefa que enviar */
+		BloqueiaEmLista(&fila->receptores, qtas_marcas);	/* tarefa colocada na espera por mensagem */
+		TROCA_CONTEXTO();						/* solicita troca de contexto, retorna com a mensagem ou sem tempo */
+		resultado = TCB[tarefa_atual].resultado;
+	}
+	
+	REG_ATOMICA_FIM();
+	
+	return resultado;
+}
+
+/* fila alterada por interrupcao com tarefas esperando: colocada na lista de
+ * pendentes e as tarefas sao acordadas na troca de contexto solicitada */
+static void FilaPendenteISR(fila_t* fila)
+{
+#if cfg_MEDIDAS_LATENCIA
+	if(!HA_PENDENTES_ISR())
+	{
+		instante_isr = LeCiclos();	/* primeira sinalizacao ainda nao processada */
+	}
+#endif
+	
+	if(!fila->pendente)
+	{
+		fila->pendente = 1;
+		fila->proximo_pendente = filas_pendentes;
+		filas_pendentes = fila;
+	}
+	
+	PEDE_TROCA_CONTEXTO();
+}
+
+/* versoes para rotinas de interrupcao: nunca esperam, retornam TEMPO_ESGOTADO
+ * se a fila estiver cheia (envio) ou vazia (recebimento). So copiam a mensagem
+ * de ou para a area da fila; as tarefas esperando na outra ponta sao acordadas
+ * fora da interrupcao, como em SemaforoLiberaISR. Uma fila sem area de 
+ * armazenamento (capacidade 0) nao pode ser usada pelas interrupcoes */
+resultado_t FilaEnviaISR(fila_t* fila, const void* mensagem)
+{
+	resultado_t resultado = TEMPO_ESGOTADO;
+	
+	REG_ATOMICA_INICIO();
+	
+	if(fila->quantidade < fila->capacidade)
+	{
+		memcpy(FilaPosicao(fila, fila->leitura + fila->quantidade), mensagem, fila->tamanho);
+		fila->quantidade++;
+		resultado = SUCESSO;
+		
+		if(fila->receptores.primeira != 0)
+		{
+			FilaPendenteISR(fila);
+		}
+	}
+	
+	REG_ATOMICA_FIM();
+	
+	return resultado;
+}
+
+resultado_t FilaRecebeISR(fila_t* fila, void* mensagem)
+{
+	resultado_t resultado = TEMPO_ESGOTADO;
+	
+	REG_ATOMICA_INICIO();
+	
+	if(fila->quantidade > 0)
+	{
+		memcpy(mensagem, FilaPosicao(fila, fila->leitura), fila->tamanho);
+		fila->leitura = (fila->leitura + 1 < fila->capacidade) ? fila->leitura + 1 : 0;
+		fila->quantidade--;
+		resultado = SUCESSO;
+		
+		if(fila->emissores.primeira != 0)
+		{
+			FilaPendenteISR(fila);
+		}
+	}
+	
+	REG_ATOMICA_FIM();
+	
+	return resultado;
+}
+
+/* entrega as mensagens guardadas pela interrupcao as tarefas esperando
+ * mensagem e o espaco aberto pela interrupcao as tarefas esperando espaco */
+static void FilaProcessaPendente(fila_t* fila)
+{
+	uint8_t tarefa;
+	
+	while(fila->quantidade > 0 && (tarefa = fila->receptores.primeira) != 0)
+	{
+		memcpy(TCB[tarefa].mensagem, FilaPosicao(fila, fila->leitura), fila->tamanho);
+		fila->leitura = (fila->leitura + 1 < fila->capacidade) ? fila->leitura + 1 : 0;
+		fila->quantidade--;
+		DesbloqueiaDaLista(tarefa);
+	}
+	
+	while(fila->quantidade < fila->capacidade && (tarefa = fila->emissores.primeira) != 0)
+	{
+		memcpy(FilaPosicao(fila, fila->leitura + fila->quantidade), TCB[tarefa].mensagem, fila->tamanho);
+		fila->quantidade++;
+		DesbloqueiaDaLista(tarefa);
+	}
+}
+
+/* passagem por referencia, sem copia da mensagem: a fila deve ter sido criada
+ * com mensagens de tamanho sizeof(void*) */
+resultado_t FilaEnviaPonteiro(fila_t* fila, void* ponteiro, tick_t qtas_marcas)
+{
+	return FilaEnvia(fila, &ponteiro, qtas_marcas);
+}
+
+resultado_t FilaRecebePonteiro(fila_t* fila, void** ponteiro, tick_t qtas_marcas)
+{
+	return FilaRecebe(fila, ponteiro, qtas_marcas);
+}
+
+uint16_t FilaQuantidade(fila_t* fila)
+{
+	return fila->quantidade;
+}
+
+/* Servicos de grupo de eventos */
+
+static uint8_t EventosSatisfeitos(uint32_t bits, uint32_t mascara, uint8_t opcoes)
+{
+	if(opcoes & EVENTOS_TODOS)
+	{
+		return (bits & mascara) == mascara;
+	}
+	return (bits & mascara) != 0;
+}
+
+/* sinaliza os eventos e acorda, em uma unica passagem pela lista, todas as 
+ * tarefas satisfeitas. Os eventos com EVENTOS_LIMPA so sao limpos no final,
+ * entao todas as tarefas veem os mesmos eventos. Retorna 1 se alguma tarefa 
+ * acordada tem prioridade maior que a tarefa atual */
+static uint8_t EventosAtualiza(eventos_t* eventos, uint32_t bits)
+{
+	uint8_t tarefa, proxima;
+	uint8_t troca = 0;
+	uint32_t limpa = 0;
+	
+	eventos->bits |= bits;
+	
+	tarefa = eventos->esperando.primeira;
+	while(tarefa != 0)
+	{
+		proxima = TCB[tarefa].proxima_bloqueada;
+		
+		if(EventosSatisfeitos(eventos->bits, TCB[tarefa].eventos, TCB[tarefa].opcoes_eventos))
+		{
+			if(TCB[tarefa].opcoes_eventos & EVENTOS_LIMPA)
+			{
+				limpa |= TCB[tarefa].eventos;
+			}
+			TCB[tarefa].eventos &= eventos->bits;		/* eventos recebidos */
+			DesbloqueiaDaLista(tarefa);					/* tarefa colocada na fila de pronta */
+			
+			if(TCB[tarefa].prioridade > TCB[tarefa_atual].prioridade)
+			{
+				troca = 1;
+			}
+		}
+		
+		tarefa = proxima;
+	}
+	
+	eventos->bits &= ~limpa;
+	
+	return troca;
+}
+
+/* chamada na troca de contexto para processar os semaforos liberados, os
+ * eventos sinalizados e as filas alteradas por interrupcao */
+static void ProcessaPendentesISR(void)
+{
+	semaforo_t *sem;
+	eventos_t *eventos;
+	fila_t *fila;
+	uint32_t bits;
+	
+	REG_ATOMICA_INICIO();
+	
+#if cfg_MEDIDAS_LATENCIA
+	tarefa_isr = 0;
+	medindo_isr = 1;		/* instante_isr foi marcado pela primeira sinalizacao */
+#endif
+	
+	while(semaforos_pendentes != 0)
+	{
+		sem = semaforos_pendentes;
+		semaforos_pendentes = sem->proximo_pendente;
+		sem->proximo_pendente = 0;
+		
+		while(sem->pendentes > 0)
+		{
+			sem->pendentes--;
+			(void)SemaforoIncrementa(sem);
+		}
+	}
+	
+	while(eventos_pendentes != 0)
+	{
+		eventos = eventos_pendentes;
+		eventos_pendentes = eventos->proximo_pendente;
+		eventos->proximo_pendente = 0;
+		
+		bits = eventos->pendentes;
+		eventos->pendentes = 0;
+		
+		(void)EventosAtualiza(eventos, bits);
+	}
+	
+	while(filas_pendentes != 0)
+	{
+		fila = filas_pendentes;
+		filas_pendentes = fila->proximo_pendente;
+		fila->proximo_pendente = 0;
+		fila->pendente = 0;
+		
+		FilaProcessaPendente(fila);
+	}
+	
+	MEDIDA_ISR_FIM();
+	
+	REG_ATOMICA_FIM();
+}
+
+/* aguarda qualquer (EVENTOS_QUALQUER) ou todos (EVENTOS_TODOS) os eventos da 
+ * mascara por no maximo qtas_marcas marcas de tempo. Com EVENTOS_LIMPA, os 
+ * eventos da mascara sao limpos ao acordar. Os eventos recebidos sao 
+ * retornados em recebidos (se diferente de 0) */
+resultado_t EventosAguarda(eventos_t* eventos, uint32_t mascara, uint8_t opcoes, 
+							uint32_t* recebidos, tick_t qtas_marcas)
+{
+	resultado_t resultado = SUCESSO;
+	uint32_t bits = 0;
+	
+	REG_ATOMICA_INICIO();
+	
+	if(EventosSatisfeitos(eventos->bits, mascara, opcoes))
+	{
+		bits = eventos->bits & mascara;
+		if(opcoes & EVENTOS_LIMPA)
+		{
+			eventos->bits &= ~mascara;
+		}
+	}else if(qtas_marcas == 0)
+	{
+		resultado = TEMPO_ESGOTADO;				/* eventos nao sinalizados e sem espera */
+	}else
+	{
+		TCB[tarefa_atual].eventos = mascara;
+		TCB[tarefa_atual].opcoes_eventos = opcoes;
+		BloqueiaEmLista(&eventos->esperando, qtas_marcas);	/* tarefa colocada na espera dos eventos */
+		TROCA_CONTEXTO();						/* solicita troca de contexto, retorna com os eventos ou sem tempo */
+		resultado = TCB[tarefa_atual].resultado;
+		if(resultado == SUCESSO)
+		{
+			bits = TCB[tarefa_atual].eventos;
+		}
+	}
+	
+	REG_ATOMICA_FIM();
+	
+	if(recebidos != 0)
+	{
+		*recebidos = bits;
+	}
+	
+	return resultado;
+}
+
+void EventosSinaliza(eventos_t* eventos, uint32_t bits)
+{
+	REG_ATOMICA_INICIO();
+	
+	if(EventosAtualiza(eventos, bits))
+	{
+		TROCA_CONTEXTO();
+	}
+	
+	REG_ATOMICA_FIM();
+}
+
+/* versao para rotinas de interrupcao: os eventos sao guardados como pendentes
+ * e processados na troca de contexto solicitada, fora da interrupcao */
+void EventosSinalizaISR(eventos_t* eventos, uint32_t bits)
+{
+	if(bits == 0)
+	{
+		return;
+	}
+	
+	REG_ATOMICA_INICIO();
+	
+#if cfg_MEDIDAS_LATENCIA
+	if(!HA_PENDENTES_ISR())
+	{
+		instante_isr = LeCiclos();	/* primeira sinalizacao ainda nao processada */
+	}
+#endif
+	
+	if(eventos->pendentes == 0)
+	{
+		eventos->proximo_pendente = eventos_pendentes;	/* grupo colocado na lista de pendentes */
+		eventos_pendentes = eventos;
+	}
+	eventos->pendentes |= bits;
+	
+	PEDE_TROCA_CONTEXTO();
+	
+	REG_ATOMICA_FIM();
+}
+
+void EventosLimpa(eventos_t* eventos, uint32_t bits)
+{
+	REG_ATOMICA_INICIO();
+	eventos->bits &= ~bits;
+	REG_ATOMICA_FIM();
+}
+
+#if cfg_MEDIDAS_LATENCIA
+/* Medidas de latencia */
+
+static void RegistraLatencia(medida_latencia_t *medida, uint8_t id_tarefa, uint8_t tipo, uint32_t ciclos)
+{
+	amostra_latencia_t *amostra;
+	
+	if(medida->amostras == 0 || ciclos < medida->minimo)
+	{
+		medida->minimo = ciclos;
+	}
+	if(ciclos > medida->maximo)
+	{
+		medida->maximo = ciclos;
+	}
+	medida->amostras++;
+	medida->soma += ciclos;
+	
+	amostra = &amostras_latencia[amostra_proxima];
+	amostra->tarefa = id_tarefa;
+	amostra->tipo = tipo;
+	amostra->ciclos = ciclos;
+	
+	if(++amostra_proxima >= cfg_AMOSTRAS_LATENCIA)
+	{
+		amostra_proxima = 0;
+	}
+	if(amostra_quantidade < cfg_AMOSTRAS_LATENCIA)
+	{
+		amostra_quantidade++;
+	}
+}
+
+static void CopiaLatencia(latencia_t *destino, const medida_latencia_t *medida)
+{
+	destino->minimo = medida->minimo;
+	destino->maximo = medida->maximo;
+	destino->amostras = medida->amostras;
+	destino->media = (medida->amostras > 0) ? (uint32_t)(medida->soma / medida->amostras) : 0;
+}
+
+/* latencias de troca de contexto (entrada na rotina de troca ate a selecao da 
+ * tarefa) e de interrupcao (chamada do servico pela interrupcao ate a tarefa 
+ * acordada executar) da tarefa, em ciclos. Ponteiros iguais a 0 sao ignorados */
+void LatenciasTarefa(uint8_t id_tarefa, latencia_t *troca, latencia_t *isr)
+{
+	if(id_tarefa == 0 || id_tarefa > NUMERO_DE_TAREFAS)
+	{
+		return;
+	}
+	
+	REG_ATOMICA_INICIO();
+	if(troca != 0)
+	{
+		CopiaLatencia(troca, &latencia_troca[id_tarefa]);
+	}
+	if(isr != 0)
+	{
+		CopiaLatencia(isr, &latencia_isr[id_tarefa]);
+	}
+	REG_ATOMICA_FIM();
+}
+
+/* copia ate maximo amostras recentes, da mais antiga para a mais nova,
+ * e retorna quantas foram copiadas */
+uint16_t LatenciasRecentes(amostra_latencia_t *amostras, uint16_t maximo)
+{
+	uint16_t quantidade, posicao, i;
+	
+	REG_ATOMICA_INICIO();
+	
+	quantidade = amostra_quantidade;
+	if(quantidade > maximo)
+	{
+		quantidade = maximo;
+	}
+	
+	/* a amostra mais antiga copiada fica quantidade posicoes antes da proxima */
+	posicao = (uint16_t)(amostra_proxima + cfg_AMOSTRAS_LATENCIA - quantidade);
+	for(i = 0; i < quantidade; i++)
+	{
+		if(posicao >= cfg_AMOSTRAS_LATENCIA)
+		{
+			posicao -= cfg_AMOSTRAS_LATENCIA;
+		}
+		amostras[i] = amostras_latencia[posicao++];
+	}
+	
+	REG_ATOMICA_FIM();
+	
+	return quantidade;
+}
+
+/* zera as medidas e o anel de amostras */
+void LatenciasZera(void)
+{
+	REG_ATOMICA_INICIO();
+	memset(latencia_troca, 0, sizeof(latencia_troca));
+	memset(latencia_isr, 0, sizeof(latencia_isr));
+	amostra_proxima = 0;
+	amostra_quantidade = 0;
+	tarefa_isr = 0;
+	REG_ATOMICA_FIM();
+}
+#endif
+
+#if cfg_ESTATISTICAS
+/* Estatisticas das tarefas */
+
+/* estatisticas de execucao da tarefa e uso da CPU, em relacao ao tempo de 
+ * execucao de todas as tarefas (inclusive a ociosa) desde o inicio. 
+ * Custo: uma leitura de LeCiclos() e uma soma de 64 bits por troca de contexto */
+void TarefaEstatisticas(uint8_t id_tarefa, estatisticas_tarefa_t *estatisticas)
+{
+	uint64_t total = 0;
+	uint64_t tempo;
+	uint32_t agora;
+	uint8_t tarefa;
+	
+	if(id_tarefa == 0 || id_tarefa > NUMERO_DE_TAREFAS)
+	{
+		return;
+	}
+	
+	REG_ATOMICA_INICIO();
+	
+	agora = LeCiclos();
+	for(tarefa = 1; tarefa <= numero_tarefas; tarefa++)
+	{
+		tempo = TCB[tarefa].tempo_execucao;
+		if(tarefa == tarefa_atual)
+		{
+			tempo += (uint32_t)(agora - inicio_execucao);	/* execucao em andamento */
+		}
+		if(tarefa == id_tarefa)
+		{
+			estatisticas->tempo_execucao = tempo;
+		}
+		total += tempo;
+	}
+	
+	estatisticas->entradas = TCB[id_tarefa].entradas;
+	estatisticas->ultima_execucao = TCB[id_tarefa].ultima_execucao;
+	
+	REG_ATOMICA_FIM();
+	
+	if(id_tarefa > numero_tarefas)
+	{
+		estatisticas->tempo_execucao = 0;
+	}
+	
+	estatisticas->uso_cpu = (total > 0) ? 
+		(uint16_t)((estatisticas->tempo_execucao * 10000u) / total) : 0;
+}
+#endif
+
+#if cfg_TRABALHOS_ISR
+/* Trabalhos adiados: as interrupcoes colocam funcoes em um anel e a tarefa 
+ * de trabalhos (TarefaTrabalhos, de prioridade alta) as executa fora da 
+ * interrupcao. A escrita do anel e feita somente pelas interrupcoes e a 
+ * leitura somente pela tarefa de trabalhos, que nao bloqueia interrupcoes */
+
+typedef struct
+{
+	trabalho_t	funcao;
+	void		*argumento;
+} trabalho_adiado_t;
+
+static trabalho_adiado_t trabalhos[cfg_TAM_TRABALHOS];
+static volatile uint8_t trabalho_escrita = 0;	/* alterado somente pelas interrupcoes */
+static volatile uint8_t trabalho_leitura = 0;	/* alterado somente pela tarefa de trabalhos */
+static semaforo_t trabalhos_prontos = {0};
+
+/* coloca funcao(argumento) no anel de trabalhos, para execucao pela tarefa de
+ * trabalhos. Tempo constante; retorna TEMPO_ESGOTADO se o anel esta cheio.
+ * A tarefa executa todos os trabalhos do anel a cada liberacao do semaforo,
+ * entao as liberacoes nao processadas sao limitadas a capacidade do anel e
+ * o contador de 8 bits do semaforo nao da a volta */
+resultado_t TrabalhoISR(trabalho_t funcao, void *argumento)
+{
+	uint8_t escrita, proxima;
+	
+	/* somente contra interrupcoes aninhadas que tambem colocam trabalhos */
+	REG_ATOMICA_INICIO();
+	
+	escrita = trabalho_escrita;
+	proxima = (uint8_t)(escrita + 1);
+	if(proxima >= cfg_TAM_TRABALHOS)
+	{
+		proxima = 0;
+	}
+	
+	if(proxima == trabalho_leitura)
+	{
+		REG_ATOMICA_FIM();
+		return TEMPO_ESGOTADO;		/* anel cheio */
+	}
+	
+	trabalhos[escrita].funcao = funcao;
+	trabalhos[escrita].argumento = argumento;
+	trabalho_escrita = proxima;		/* publica o trabalho para a tarefa */
+	
+	if((uint16_t)trabalhos_prontos.contador + trabalhos_prontos.pendentes < cfg_TAM_TRABALHOS - 1)
+	{
+		SemaforoLiberaISR(&trabalhos_prontos);
+	}
+	
+	REG_ATOMICA_FIM();
+	
+	return SUCESSO;
+}
+
+/* tarefa de trabalhos: deve ser criada pela aplicacao (CriaTarefa ou tabela
+ * de tarefas) com prioridade maior que as tarefas que dependem dos trabalhos */
+void TarefaTrabalhos(void)
+{
+	uint8_t leitura;
+	trabalho_t funcao;
+	void *argumento;
+	
+	for(;;)
+	{
+		SemaforoAguarda(&trabalhos_prontos);
+		
+		leitura = trabalho_leitura;
+		while(leitura != trabalho_escrita)
+		{
+			funcao = trabalhos[leitura].funcao;
+			argumento = trabalhos[leitura].argumento;
+			
+			if(++leitura >= cfg_TAM_TRABALHOS)
+			{
+				leitura = 0;
+			}
+			trabalho_leitura = leitura;	/* libera a posicao para as interrupcoes */
+			
+			funcao(argumento);
+		}
+	}
+}
+#endif
+
+#if cfg_TEMPORIZADORES
+/* Temporizadores de software: os temporizadores ativos ficam em uma lista 
+ * delta, como a lista de espera das tarefas, avancada pela marca de tempo. 
+ * Os vencidos vao para uma fila e as suas funcoes sao executadas pela tarefa
+ * de temporizadores, entao muitas atividades periodicas compartilham uma 
+ * unica pilha e um unico TCB */
+
+static temporizador_t *primeiro_vencido = 0;
+static temporizador_t *ultimo_vencido = 0;
+static semaforo_t temporizadores_vencidos = {0};
+
+/* insere o temporizador na lista para vencer daqui a qtas_marcas */
+static void InsereTemporizador(temporizador_t* temporizador, tick_t qtas_marcas)
+{
+	temporizador_t **anterior = &lista_temporizadores;
+	
+	/* procura a posicao, descontando os tempos dos que vencem antes */
+	while(*anterior != 0 && (*anterior)->tempo <= qtas_marcas)
+	{
+		qtas_marcas -= (*anterior)->tempo;
+		anterior = &(*anterior)->proximo;
+	}
+	
+	temporizador->tempo = qtas_marcas;
+	temporizador->proximo = *anterior;
+	if(*anterior != 0)
+	{
+		(*anterior)->tempo -= qtas_marcas;
+	}
+	*anterior = temporizador;
+	temporizador->ativo = 1;
+}
+
+/* retira o temporizador da lista, se ele estiver ativo */
+static void RemoveTemporizador(temporizador_t* temporizador)
+{
+	temporizador_t **anterior = &lista_temporizadores;
+	
+	if(!temporizador->ativo)
+	{
+		return;
+	}
+	
+	while(*anterior != temporizador)
+	{
+		anterior = &(*anterior)->proximo;
+	}
+	
+	/* o tempo restante passa para o proximo temporizador da lista */
+	if(temporizador->proximo != 0)
+	{
+		temporizador->proximo->tempo += temporizador->tempo;
+	}
+	*anterior = temporizador->proximo;
+	temporizador->proximo = 0;
+	temporizador->ativo = 0;
+}
+
+/* avanca a lista de temporizadores em qtas_marcas: os vencidos sao 
+ * recarregados (periodo > 0) e colocados na fila da tarefa de 
+ * temporizadores. Chamada pela marca de tempo */
+static void AvancaTemporizadores(tick_t qtas_marcas)
+{
+	temporizador_t *temporizador;
+	
+	while(lista_temporizadores != 0)
+	{
+		temporizador = lista_temporizadores;
+		if(temporizador->tempo > qtas_marcas)
+		{
+			temporizador->tempo -= qtas_marcas;
+			break;
+		}
+		
+		qtas_marcas -= temporizador->tempo;
+		lista_temporizadores = temporizador->proximo;
+		temporizador->proximo = 0;
+		temporizador->ativo = 0;
+		
+		if(temporizador->periodo > 0)
+		{
+			/* recarga a partir do vencimento, sem acumulo de atraso */
+			InsereTemporizador(temporizador, temporizador->periodo);
+		}
+		
+		if(temporizador->disparos < 0xFF)
+		{
+			temporizador->disparos++;
+		}
+		
+		if(!temporizador->vencido)
+		{
+			temporizador->vencido = 1;
+			temporizador->proximo_vencido = 0;
+			if(ultimo_vencido != 0)
+			{
+				ultimo_vencido->proximo_vencido = temporizador;
+			}else
+			{
+				primeiro_vencido = temporizador;
+				(void)SemaforoIncrementa(&temporizadores_vencidos);	/* acorda a tarefa */
+			}
+			ultimo_vencido = temporizador;
+		}
+	}
+}
+
+void TemporizadorCria(temporizador_t* temporizador, trabalho_t funcao, void *argumento)
+{
+	memset(temporizador, 0, sizeof(temporizador_t));
+	temporizador->funcao = funcao;
+	temporizador->argumento = argumento;
+}
+
+/* inicia (ou reinicia) o temporizador para vencer daqui a qtas_marcas e, se 
+ * periodo > 0, a cada periodo marcas depois disso */
+void TemporizadorInicia(temporizador_t* temporizador, tick_t qtas_marcas, tick_t periodo)
+{
+	if(qtas_marcas == 0)
+	{
+		qtas_marcas = 1;		/* vence na proxima marca de tempo */
+	}
+	
+	REG_ATOMICA_INICIO();
+	RemoveTemporizador(temporizador);
+	temporizador->periodo = periodo;
+	InsereTemporizador(temporizador, qtas_marcas);
+	REG_ATOMICA_FIM();
+}
+
+/* para o temporizador e cancela os vencimentos ainda nao executados */
+void TemporizadorPara(temporizador_t* temporizador)
+{
+	REG_ATOMICA_INICIO();
+	RemoveTemporizador(temporizador);
+	temporizador->disparos = 0;
+	REG_ATOMICA_FIM();
+}
+
+uint8_t TemporizadorAtivo(temporizador_t* temporizador)
+{
+	return temporizador->ativo;
+}
+
+/* tarefa de temporizadores: deve ser criada pela aplicacao (CriaTarefa ou 
+ * tabela de tarefas) com prioridade maior que as tarefas que dependem dos
+ * temporizadores. As funcoes executam uma vez por vencimento, em ordem */
+void TarefaTemporizadores(void)
+{
+	temporizador_t *temporizador;
+	uint8_t disparos;
+	
+	for(;;)
+	{
+		SemaforoAguarda(&temporizadores_vencidos);
+		
+		for(;;)
+		{
+			REG_ATOMICA_INICIO();
+			temporizador = primeiro_vencido;
+			if(temporizador != 0)
+			{
+				primeiro_vencido = temporizador->proximo_vencido;
+				if(primeiro_vencido == 0)
+				{
+					ultimo_vencido = 0;
+				}
+				temporizador->vencido = 0;
+				disparos = temporizador->disparos;
+				temporizador->disparos = 0;
+			}
+			REG_ATOMICA_FIM();
+			
+			if(temporizador == 0)
+			{
+				break;
+			}
+			
+			while(disparos-- > 0)
+			{
+				temporizador->funcao(temporizador->argumento);
+			}
+		}
+	}
+}
+#endif
+
+#if cfg_MEDIDAS_REGIAO_ATOMICA
+/* Medidas das regioes criticas */
+
+/* chamada apos a entrada na regiao critica: marca o inicio da mais externa */
+void RegiaoAtomicaInicio(void)
+{
+	if(regiao_atomica == 1)
+	{
+		inicio_regiao = LeCiclos();
+	}
+}
+
+/* chamada antes da saida da regiao critica: na mais externa, guarda o maior
+ * tempo com as interrupcoes desabilitadas do servico (funcao) */
+void RegiaoAtomicaFim(const char *servico)
+{
+	uint32_t ciclos;
+	uint8_t i;
+	
+	if(regiao_atomica != 1)
+	{
+		return;		/* regiao aninhada ou interrupcoes ja desabilitadas na entrada */
+	}
+	
+	ciclos = LeCiclos() - inicio_regiao;
+	
+	for(i = 0; i < numero_regioes_medidas; i++)
+	{
+		if(regioes_medidas[i].servico == servico)
+		{
+			break;
+		}
+	}
+	
+	if(i == numero_regioes_medidas)
+	{
+		if(numero_regioes_medidas >= cfg_SERVICOS_MEDIDOS)
+		{
+			return;		/* tabela cheia */
+		}
+		regioes_medidas[i].servico = servico;
+		regioes_medidas[i].maximo = 0;
+		numero_regioes_medidas++;
+	}
+	
+	if(ciclos > regioes_medidas[i].maximo)
+	{
+		regioes_medidas[i].maximo = ciclos;
+	}
+}
+
+/* chamadas por PortEsperaTrocaContexto(): a janela com as interrupcoes 
+ * habilitadas, em que as outras tarefas executam, nao conta no tempo da 
+ * regiao. A pausa retorna os ciclos ja passados na regiao, guardados na pilha
+ * da tarefa ate a volta */
+uint32_t RegiaoAtomicaPausa(void)
+{
+	return LeCiclos() - inicio_regiao;
+}
+
+void RegiaoAtomicaRetoma(uint32_t ciclos)
+{
+	inicio_regiao = LeCiclos() - ciclos;
+}
+
+/* copia ate maximo medidas e retorna quantas foram copiadas */
+uint8_t RegioesAtomicasMedidas(regiao_medida_t *medidas, uint8_t maximo)
+{
+	uint8_t i;
+	
+	PortEntraRegiaoAtomica();		/* sem medir a propria consulta */
+	
+	if(maximo > numero_regioes_medidas)
+	{
+		maximo = numero_regioes_medidas;
+	}
+	for(i = 0; i < maximo; i++)
+	{
+		medidas[i] = regioes_medidas[i];
+	}
+	
+	PortSaiRegiaoAtomica();
+	
+	return maximo;
+}
+
+void RegioesAtomicasZera(void)
+{
+	PortEntraRegiaoAtomica();
+	numero_regioes_medidas = 0;
+	PortSaiRegiaoAtomica();
+}
+#endif
@@ -0,0 +1,722 @@
+/*
+ * multitarefas.h
+ *
+ */ 
+
+
+#ifndef MULTITAREFAS_H_
+#define MULTITAREFAS_H_
+
+#include "stdint.h"
+
+/******************************************************************/
+/* macros de configuracao */
+
+/* a configuracao (NUMERO_DE_TAREFAS, PRIORIDADE_MAXIMA, cfg_...) fica no 
+   arquivo conf_rtos.h de cada projeto */
+#include "conf_rtos.h"
+
+/* numero de pilhas do conjunto de tarefas dinamicas (CriaTarefaDinamica()),
+   0 desabilita */
+#ifndef cfg_TAREFAS_DINAMICAS
+#define cfg_TAREFAS_DINAMICAS  0
+#endif
+
+/* com a tabela estatica de tarefas (cfg_TABELA_DE_TAREFAS), o numero de 
+   tarefas e o numero de entradas da tabela mais as tarefas dinamicas */
+#if defined(cfg_TABELA_DE_TAREFAS) && !defined(NUMERO_DE_TAREFAS)
+#define TABELA_CONTA(tarefa, nome, tamanho, prioridade)		+ 1
+#define NUMERO_DE_TAREFAS	(0 cfg_TABELA_DE_TAREFAS(TABELA_CONTA) + cfg_TAREFAS_DINAMICAS)
+#endif
+
+#ifndef NUMERO_DE_TAREFAS
+#error "conf_rtos.h deve definir NUMERO_DE_TAREFAS ou cfg_TABELA_DE_TAREFAS"
+#endif
+
+#ifndef PRIORIDADE_MAXIMA
+#error "conf_rtos.h deve definir PRIORIDADE_MAXIMA"
+#endif
+
+/* valores padrao das configuracoes opcionais */
+
+/* fatia de tempo padrao (em marcas) do rodizio entre tarefas de mesma prioridade,
+   0 desabilita o rodizio */
+#ifndef cfg_QUANTUM_MARCAS
+#define cfg_QUANTUM_MARCAS  10
+#endif
+
+/* modos de escalonamento (cfg_MODO_ESCALONAMENTO) */
+#define ESCALONAMENTO_COOPERATIVO	0	/* troca somente quando a tarefa bloqueia ou cede o processador */
+#define ESCALONAMENTO_PREEMPTIVO	1	/* a tarefa pronta de maior prioridade assume o processador */
+#define ESCALONAMENTO_FATIA_TEMPO	2	/* preemptivo com rodizio entre tarefas de mesma prioridade */
+
+/* sem cfg_MODO_ESCALONAMENTO, o modo vem de cfg_PREEMPTIVO e cfg_QUANTUM_MARCAS */
+#ifndef cfg_MODO_ESCALONAMENTO
+#if defined(cfg_PREEMPTIVO) && !cfg_PREEMPTIVO
+#define cfg_MODO_ESCALONAMENTO  ESCALONAMENTO_COOPERATIVO
+#elif cfg_QUANTUM_MARCAS > 0
+#define cfg_MODO_ESCALONAMENTO  ESCALONAMENTO_FATIA_TEMPO
+#else
+#define cfg_MODO_ESCALONAMENTO  ESCALONAMENTO_PREEMPTIVO
+#endif
+#endif
+
+#if cfg_MODO_ESCALONAMENTO > ESCALONAMENTO_FATIA_TEMPO
+#error "cfg_MODO_ESCALONAMENTO invalido"
+#endif
+
+/* sistema preemptivo (1) ou cooperativo (0), usado pelas portas */
+#ifndef cfg_PREEMPTIVO
+#define cfg_PREEMPTIVO  (cfg_MODO_ESCALONAMENTO != ESCALONAMENTO_COOPERATIVO)
+#elif cfg_PREEMPTIVO != (cfg_MODO_ESCALONAMENTO != ESCALONAMENTO_COOPERATIVO)
+#error "cfg_PREEMPTIVO e cfg_MODO_ESCALONAMENTO nao combinam"
+#endif
+
+/* modo sem marcas de tempo (tickless) */
+#ifndef cfg_MODO_SEM_MARCA
+#define cfg_MODO_SEM_MARCA  0
+#endif
+
+/* medidas de latencia da troca de contexto e das interrupcoes */
+#ifndef cfg_MEDIDAS_LATENCIA
+#define cfg_MEDIDAS_LATENCIA  0
+#endif
+
+/* numero de amostras recentes guardadas pelas medidas de latencia */
+#ifndef cfg_AMOSTRAS_LATENCIA
+#define cfg_AMOSTRAS_LATENCIA  32
+#endif
+
+/* tamanho em palavras de cada pilha do conjunto de tarefas dinamicas */
+#ifndef cfg_TAM_PILHA_DINAMICA
+#define cfg_TAM_PILHA_DINAMICA  (TAM_MINIMO_PILHA + 64)
+#endif
+
+/* verificacao do estouro de pilha a cada troca de contexto */
+#ifndef cfg_VERIFICA_PILHA
+#define cfg_VERIFICA_PILHA  0
+#endif
+
+/* 1 = a aplicacao fornece a funcao EstouroDePilha(), chamada no estouro */
+#ifndef cfg_ESTOURO_PILHA_USUARIO
+#define cfg_ESTOURO_PILHA_USUARIO  0
+#endif
+
+/* rejeita prioridades repetidas na tabela estatica de tarefas */
+#ifndef cfg_PRIORIDADES_UNICAS
+#define cfg_PRIORIDADES_UNICAS  0
+#endif
+
+/* trabalhos adiados das interrupcoes (TrabalhoISR() e TarefaTrabalhos()) */
+#ifndef cfg_TRABALHOS_ISR
+#define cfg_TRABALHOS_ISR  0
+#endif
+
+/* tamanho do anel de trabalhos adiados (ate 255, guarda um trabalho a menos) */
+#ifndef cfg_TAM_TRABALHOS
+#define cfg_TAM_TRABALHOS  16
+#endif
+#if cfg_TRABALHOS_ISR && (cfg_TAM_TRABALHOS < 2 || cfg_TAM_TRABALHOS > 255)
+#error "cfg_TAM_TRABALHOS deve ser de 2 a 255"
+#endif
+
+/* classe de escalonamento EDF (prazo mais proximo primeiro) para tarefas
+   periodicas criadas com CriaTarefaEDF() */
+#ifndef cfg_EDF
+#define cfg_EDF  0
+#endif
+
+/* nivel de prioridade fixa das tarefas EDF: quando ele e o maior nivel com 
+   tarefas prontas, executa a tarefa EDF de prazo absoluto mais proximo. Uma
+   tarefa comum que herda este nivel (mutex) so executa sem tarefa EDF pronta */
+#ifndef cfg_PRIORIDADE_EDF
+#define cfg_PRIORIDADE_EDF  1
+#endif
+
+#if cfg_EDF && cfg_PRIORIDADE_EDF > PRIORIDADE_MAXIMA
+#error "cfg_PRIORIDADE_EDF maior que PRIORIDADE_MAXIMA"
+#endif
+
+/* orcamentos de execucao por tarefa (TarefaOrcamento()), verificados na 
+   marca de tempo, e registro das perdas de prazo e dos estouros */
+#ifndef cfg_ORCAMENTOS
+#define cfg_ORCAMENTOS  0
+#endif
+
+/* prioridade das tarefas rebaixadas por estouro do orcamento */
+#ifndef cfg_PRIORIDADE_REBAIXADA
+#define cfg_PRIORIDADE_REBAIXADA  1
+#endif
+
+/* numero de ocorrencias recentes guardadas (OcorrenciasRecentes()) */
+#ifndef cfg_OCORRENCIAS
+#define cfg_OCORRENCIAS  16
+#endif
+
+/* rastro dos eventos do nucleo (trocas de contexto, tarefas prontas e 
+   bloqueadas, despertares e semaforos) em um anel de registros de 8 bytes */
+#ifndef cfg_RASTRO
+#define cfg_RASTRO  0
+#endif
+
+/* numero de registros do anel do rastro (potencia de 2) */
+#ifndef cfg_TAM_RASTRO
+#define cfg_TAM_RASTRO  256
+#endif
+
+#if cfg_RASTRO && (cfg_TAM_RASTRO & (cfg_TAM_RASTRO - 1)) != 0
+#error "cfg_TAM_RASTRO deve ser potencia de 2"
+#endif
+
+/* temporizadores de software (TemporizadorInicia() e TarefaTemporizadores()) */
+#ifndef cfg_TEMPORIZADORES
+#define cfg_TEMPORIZADORES  0
+#endif
+
+/* medida do maior tempo com as interrupcoes desabilitadas por servico */
+#ifndef cfg_MEDIDAS_REGIAO_ATOMICA
+#define cfg_MEDIDAS_REGIAO_ATOMICA  0
+#endif
+
+/* numero de servicos (funcoes) com regioes criticas medidas */
+#ifndef cfg_SERVICOS_MEDIDOS
+#define cfg_SERVICOS_MEDIDOS  32
+#endif
+
+/* estatisticas de execucao das tarefas (uso da CPU) */
+#ifndef cfg_ESTATISTICAS
+#define cfg_ESTATISTICAS  0
+#endif
+
+/******************************************************************/
+/* interface com a porta (cpu-port.h e cpu-port.c de cada processador)
+
+   A porta fornece:
+   - tipos e macros: stackptr_t, SP_TYPECAST, TAM_MINIMO_PILHA
+   - regiao critica: PortEntraRegiaoAtomica() e PortSaiRegiaoAtomica(), que
+     desabilitam e restauram as interrupcoes com o contador regiao_atomica
+     (aninhamento e estado das interrupcoes na entrada da regiao mais externa)
+   - troca de contexto: TROCA_CONTEXTO(), que deve chamar 
+     TrocaContextoDasTarefas() e trocar para a pilha indicada em SP; dentro 
+     de uma regiao critica, a troca acontece na propria TROCA_CONTEXTO() e a 
+     regiao continua critica quando a tarefa volta a executar,
+     PEDE_TROCA_CONTEXTO(), que somente solicita a troca (usada pelas 
+     interrupcoes, sem habilitar as interrupcoes), e GERA_INTERRUPCAO_SW(), 
+     que inicia a primeira tarefa
+   - CriaContexto(), com o endereco de retorno da tarefa em TarefaTermina(),
+     ConfiguraMarcaTempo() e DormeSemMarcaDeTempo()
+   - LeCiclos(), contador crescente de ciclos (ou outra unidade fina de tempo)
+     usado nas medidas de latencia e nas estatisticas das tarefas
+   - a rotina da marca de tempo, que chama ExecutaMarcaDeTempo() e, se 
+     cfg_PREEMPTIVO, TrocaContextoSeNecessarioISR()
+   - na rotina de troca de contexto, o retorno direto quando 
+     TrocaContextoNecessaria() retornar 0, sem salvar e restaurar o contexto
+   - opcionalmente, CICLOS_TROCA_CONTEXTO e CICLOS_SALVA_RESTAURA, os ciclos 
+     gastos pela interrupcao de troca e pelo salvamento e restauracao do 
+     contexto, usados na estimativa dos ciclos economizados, e CICLOS_POR_US,
+     as unidades de LeCiclos() por microssegundo, gravado no rastro */
+#include "cpu-port.h"
+
+/* regioes criticas aninhadas: regiao_atomica guarda o numero de regioes
+   aninhadas da tarefa atual e, se as interrupcoes ja estavam desabilitadas
+   na entrada da regiao mais externa, REGIAO_DESABILITADAS. As interrupcoes 
+   so sao habilitadas na saida da regiao mais externa, e somente se estavam 
+   habilitadas na entrada. Na troca de contexto o contador vale 0: a tarefa
+   que espera a troca dentro de uma regiao guarda o seu contador na pilha, em
+   PortEsperaTrocaContexto() */
+extern volatile uint32_t regiao_atomica;
+
+#define REGIAO_ANINHAMENTO		0x000000FF
+#define REGIAO_DESABILITADAS	0x80000000
+
+void PortEntraRegiaoAtomica(void);
+void PortSaiRegiaoAtomica(void);
+
+#if cfg_MEDIDAS_REGIAO_ATOMICA
+void RegiaoAtomicaInicio(void);
+void RegiaoAtomicaFim(const char *servico);
+uint32_t RegiaoAtomicaPausa(void);
+void RegiaoAtomicaRetoma(uint32_t ciclos);
+#define REG_ATOMICA_INICIO()	PortEntraRegiaoAtomica(); RegiaoAtomicaInicio();
+#define REG_ATOMICA_FIM()		RegiaoAtomicaFim(__func__); PortSaiRegiaoAtomica();
+#else
+#define REG_ATOMICA_INICIO()	PortEntraRegiaoAtomica();
+#define REG_ATOMICA_FIM()		PortSaiRegiaoAtomica();
+#endif
+
+#ifndef CICLOS_TROCA_CONTEXTO
+#define CICLOS_TROCA_CONTEXTO	0
+#endif
+
+#ifndef CICLOS_SALVA_RESTAURA
+#define CICLOS_SALVA_RESTAURA	0
+#endif
+
+#ifndef CICLOS_POR_US
+#define CICLOS_POR_US	(cfg_CPU_CLOCK_HZ / 1000000)
+#endif
+
+/* padrao gravado nas pilhas na criacao das tarefas, para a marca de agua 
+   e para a verificacao de estouro */
+#define PADRAO_PILHA		0xA5A5A5A5
+
+typedef  void (*tarefa_t)(void);
+typedef enum {PRONTA, ESPERA, TERMINADA} estado_tarefa_t;
+typedef enum {SUCESSO, TEMPO_ESGOTADO, INTERROMPIDA, INVALIDA} resultado_t;
+typedef uint8_t	  prioridade_t;
+typedef uint32_t  tick_t;
+
+#define ESPERA_INFINITA		((tick_t)0xFFFFFFFF)	/* tempo limite das esperas sem limite */
+
+/**
+* \struct lista_bloqueio_t
+* Lista de tarefas bloqueadas em um objeto do sistema (semaforo, mutex), 
+* ordenada pela prioridade das tarefas
+*/
+
+typedef struct
+{
+	uint8_t		primeira;		///< Tarefa de maior prioridade esperando (0 = nenhuma)
+} lista_bloqueio_t;
+
+struct mutex_s;
+
+/**
+* \struct tcb_t
+* Estrutura de controle de tarefas
+*/
+
+typedef struct
+{
+	const char		*nome;
+	stackptr_t 	stack_pointer;
+	stackptr_t		pilha;				///< inicio (endereco mais baixo) da area da pilha
+	uint16_t		tamanho_pilha;		///< tamanho da pilha em palavras
+	estado_tarefa_t estado;
+	prioridade_t 	prioridade;			///< prioridade efetiva (com heranca de prioridade)
+	prioridade_t 	prioridade_base;	///< prioridade definida na criacao da tarefa
+	tick_t			tempo_espera;		///< marcas de espera alem da tarefa anterior na lista de espera
+	uint8_t			proxima_pronta;		///< proxima tarefa pronta de mesma prioridade (TERMINADA: proximo TCB livre)
+	uint8_t			anterior_pronta;	///< tarefa pronta anterior de mesma prioridade
+	tick_t			quantum;			///< fatia de tempo da tarefa no rodizio (0 = sem rodizio, so com ESCALONAMENTO_FATIA_TEMPO)
+	tick_t			fatia_restante;		///< marcas que restam da fatia de tempo atual
+	uint8_t			proxima_espera;		///< proxima tarefa na lista de espera por tempo
+	uint8_t			anterior_espera;	///< tarefa anterior na lista de espera por tempo
+	uint8_t			proxima_bloqueada;	///< proxima tarefa na lista de bloqueio
+	lista_bloqueio_t *lista_bloqueio;	///< lista de bloqueio em que a tarefa esta (0 = nenhuma)
+	struct mutex_s	*mutex_aguardado;	///< mutex que a tarefa espera (0 = nenhum)
+	struct mutex_s	*mutexes;			///< mutexes que pertencem a tarefa
+	resultado_t		resultado;			///< resultado da ultima espera em lista de bloqueio
+	void			*mensagem;			///< mensagem da tarefa esperando em uma fila
+	uint32_t		eventos;			///< eventos esperados e, ao acordar, eventos recebidos
+	uint8_t			opcoes_eventos;		///< opcoes da espera por eventos
+#if cfg_EDF
+	tick_t			periodo;			///< periodo da tarefa EDF (0 = tarefa de prioridade fixa)
+	tick_t			prazo;				///< prazo relativo a cada liberacao
+	tick_t			liberacao;			///< marca de tempo da liberacao do trabalho atual
+	tick_t			prazo_absoluto;		///< liberacao + prazo, chave do escalonamento EDF
+	uint8_t			posicao_edf;		///< posicao no heap das tarefas EDF prontas (0 = fora)
+#endif
+#if cfg_EDF || cfg_ORCAMENTOS
+	uint32_t		perdas_prazo;		///< trabalhos terminados depois do prazo
+#endif
+#if cfg_ORCAMENTOS
+	tick_t			orcamento;			///< marcas de execucao por ativacao (0 = sem limite)
+	tick_t			consumo;			///< marcas executadas na ativacao atual
+	uint32_t		estouros;			///< ativacoes que passaram do orcamento
+	uint8_t			acao_orcamento;		///< acao no estouro (ORCAMENTO_CONTA, ...)
+	uint8_t			rebaixada;			///< 1 = prioridade rebaixada ate o fim da ativacao
+#endif
+#if cfg_ESTATISTICAS
+	uint64_t		tempo_execucao;		///< ciclos de execucao acumulados
+	uint32_t		entradas;			///< numero de vezes que a tarefa assumiu o processador
+	uint32_t		ultima_execucao;	///< ciclos (LeCiclos()) da ultima vez que assumiu o processador
+#endif
+}tcb_t;
+
+extern  uint8_t		tarefa_atual;
+extern  uint8_t		proxima_tarefa;
+extern  tcb_t		TCB[NUMERO_DE_TAREFAS+1];
+extern  stackptr_t	ponteiro_de_pilha;
+extern  prioridade_t Prioridades[PRIORIDADE_MAXIMA+1];
+
+/**
+* \struct semaforo_t
+* Estrutura de controle do semaforo
+*/
+
+typedef struct semaforo_s
+{
+	uint8_t     contador;            ///< Contador do semaforo
+	lista_bloqueio_t esperando;      ///< Tarefas esperando, por prioridade
+	uint8_t     pendentes;           ///< Liberacoes por interrupcao ainda nao processadas
+	struct semaforo_s *proximo_pendente;	///< Proximo semaforo com liberacoes pendentes
+} semaforo_t;
+
+/* funcao executada pela tarefa de trabalhos adiados */
+typedef void (*trabalho_t)(void *argumento);
+
+/**
+* \struct temporizador_t
+* Estrutura de controle do temporizador de software. A funcao e executada 
+* pela tarefa de temporizadores (TarefaTemporizadores) quando o tempo termina.
+* Inicializar com TemporizadorCria().
+*/
+
+typedef struct temporizador_s
+{
+	trabalho_t			funcao;			///< Funcao executada no vencimento
+	void				*argumento;		///< Argumento da funcao
+	tick_t				periodo;		///< Periodo de recarga automatica (0 = uma vez)
+	tick_t				tempo;			///< Marcas alem do temporizador anterior na lista
+	struct temporizador_s *proximo;		///< Proximo temporizador ativo
+	struct temporizador_s *proximo_vencido;	///< Proximo temporizador vencido
+	uint8_t				ativo;			///< 1 = na lista de temporizadores ativos
+	uint8_t				vencido;		///< 1 = na lista de vencidos da tarefa
+	uint8_t				disparos;		///< Vencimentos ainda nao executados pela tarefa
+} temporizador_t;
+
+/**
+* \struct mutex_t
+* Estrutura de controle do mutex (exclusao mutua com dono, travamento
+* recursivo e heranca de prioridade). Inicializar com {0}.
+*/
+
+typedef struct mutex_s
+{
+	uint8_t				dono;			///< Tarefa dona do mutex (0 = livre)
+	uint8_t				recursao;		///< Numero de travamentos do dono
+	lista_bloqueio_t	esperando;		///< Tarefas esperando, por prioridade
+	struct mutex_s		*proximo;		///< Proximo mutex do mesmo dono
+} mutex_t;
+
+/**
+* \struct fila_t
+* Estrutura de controle da fila de mensagens de tamanho fixo. A area de 
+* armazenamento (tamanho * capacidade bytes) e fornecida pelo usuario.
+*/
+
+typedef struct fila_s
+{
+	uint8_t				*buffer;		///< Area de armazenamento das mensagens
+	uint16_t			tamanho;		///< Tamanho de cada mensagem em bytes
+	uint16_t			capacidade;		///< Numero maximo de mensagens
+	uint16_t			quantidade;		///< Numero de mensagens na fila
+	uint16_t			leitura;		///< Posicao da proxima mensagem a ser lida
+	lista_bloqueio_t	receptores;		///< Tarefas esperando mensagem, por prioridade
+	lista_bloqueio_t	emissores;		///< Tarefas esperando espaco, por prioridade
+	uint8_t				pendente;		///< Alterada por interrupcao, tarefas ainda nao acordadas
+	struct fila_s		*proximo_pendente;	///< Proxima fila alterada por interrupcao
+} fila_t;
+
+/**
+* \struct trocas_contexto_t
+* Contadores das trocas de contexto
+*/
+
+typedef struct
+{
+	uint32_t	realizadas;				///< Trocas de contexto para outra tarefa
+	uint32_t	evitadas;				///< Pedidos descartados antes de gerar a interrupcao de troca
+	uint32_t	abreviadas;				///< Interrupcoes de troca encerradas sem salvar e restaurar o contexto
+	uint64_t	ciclos_economizados;	///< Estimativa dos ciclos economizados pelos dois casos acima
+} trocas_contexto_t;
+
+/**
+* \struct latencia_t
+* Latencia minima, maxima e media de uma tarefa, em ciclos
+*/
+
+typedef struct
+{
+	uint32_t	minimo;			///< Menor latencia medida
+	uint32_t	maximo;			///< Maior latencia medida
+	uint32_t	media;			///< Media das latencias medidas
+	uint32_t	amostras;		///< Numero de medidas
+} latencia_t;
+
+#define LATENCIA_TROCA		0	/* amostra da troca de contexto */
+#define LATENCIA_ISR		1	/* amostra da interrupcao ate a tarefa acordada */
+
+/**
+* \struct amostra_latencia_t
+* Amostra do anel de latencias recentes
+*/
+
+typedef struct
+{
+	uint8_t		tarefa;			///< Tarefa que passou a executar
+	uint8_t		tipo;			///< LATENCIA_TROCA ou LATENCIA_ISR
+	uint32_t	ciclos;			///< Latencia em ciclos
+} amostra_latencia_t;
+
+/* eventos do rastro */
+#define RASTRO_TROCA				1	/* tarefa passa a executar (dado = tarefa que saiu) */
+#define RASTRO_PRONTA				2	/* tarefa colocada na fila de prontas (dado = prioridade) */
+#define RASTRO_BLOQUEIA				3	/* tarefa retirada da fila de prontas (dado = prioridade) */
+#define RASTRO_DESPERTA				4	/* espera por tempo terminada na marca (dado = marca) */
+#define RASTRO_SEMAFORO_LIBERA		5	/* semaforo liberado (tarefa acordada ou 0, dado = semaforo) */
+#define RASTRO_SEMAFORO_AGUARDA		6	/* tarefa aguarda o semaforo (dado = semaforo) */
+
+#define RASTRO_MAGICO		0x52545352	/* "RSTR" */
+
+/**
+* \struct rastro_registro_t
+* Registro de 8 bytes do rastro
+*/
+
+typedef struct
+{
+	uint32_t	ciclos;			///< Instante do evento (LeCiclos())
+	uint8_t		evento;			///< RASTRO_TROCA, RASTRO_PRONTA, ...
+	uint8_t		tarefa;			///< Tarefa do evento
+	uint16_t	dado;			///< Dado do evento (16 bits baixos do semaforo ou da marca)
+} rastro_registro_t;
+
+/**
+* \struct rastro_t
+* Anel do rastro: a copia da memoria desta estrutura (little-endian) e lida 
+* pelo decodificador no computador (ferramentas/decodifica_rastro.c)
+*/
+
+typedef struct
+{
+	uint32_t			magico;			///< RASTRO_MAGICO
+	uint32_t			ciclos_por_us;	///< Unidades de LeCiclos() por microssegundo
+	uint32_t			total;			///< Registros gravados desde o inicio (o proximo e total % tamanho)
+	uint16_t			tamanho;		///< cfg_TAM_RASTRO
+	uint8_t				ativo;			///< 0 = rastro parado
+	uint8_t				reservado;
+	rastro_registro_t	registros[cfg_TAM_RASTRO];
+} rastro_t;
+
+/* acoes no estouro do orcamento de execucao */
+#define ORCAMENTO_CONTA		0	/* somente conta e registra */
+#define ORCAMENTO_REBAIXA	1	/* cfg_PRIORIDADE_REBAIXADA ate o fim da ativacao */
+#define ORCAMENTO_SUSPENDE	2	/* suspende a tarefa (TarefaContinua() a retoma) */
+
+#define OCORRENCIA_PRAZO		0	/* trabalho terminado depois do prazo */
+#define OCORRENCIA_ORCAMENTO	1	/* ativacao passou do orcamento */
+
+/**
+* \struct ocorrencia_t
+* Ocorrencia do registro de perdas de prazo e estouros de orcamento
+*/
+
+typedef struct
+{
+	tick_t		marca;			///< Marca de tempo da ocorrencia
+	uint8_t		tarefa;			///< Tarefa
+	uint8_t		tipo;			///< OCORRENCIA_PRAZO ou OCORRENCIA_ORCAMENTO
+} ocorrencia_t;
+
+/**
+* \struct estatisticas_tarefa_t
+* Estatisticas de execucao de uma tarefa
+*/
+
+typedef struct
+{
+	uint64_t	tempo_execucao;		///< Ciclos de execucao acumulados
+	uint32_t	entradas;			///< Numero de vezes que assumiu o processador
+	uint32_t	ultima_execucao;	///< Ciclos (LeCiclos()) da ultima vez que assumiu o processador
+	uint16_t	uso_cpu;			///< Uso da CPU em centesimos de por cento (10000 = 100%)
+} estatisticas_tarefa_t;
+
+/**
+* \struct regiao_medida_t
+* Maior tempo com as interrupcoes desabilitadas de um servico
+*/
+
+typedef struct
+{
+	const char	*servico;		///< Nome da funcao com a regiao critica
+	uint32_t	maximo;			///< Maior tempo medido, em ciclos (LeCiclos())
+} regiao_medida_t;
+
+/* opcoes da espera por eventos */
+#define EVENTOS_QUALQUER	0x00	/* acorda com qualquer evento da mascara */
+#define EVENTOS_TODOS		0x01	/* acorda somente com todos os eventos da mascara */
+#define EVENTOS_LIMPA		0x02	/* limpa os eventos da mascara ao acordar */
+
+/**
+* \struct eventos_t
+* Estrutura de controle do grupo de eventos (mapa de bits). Inicializar com {0}.
+*/
+
+typedef struct eventos_s
+{
+	uint32_t			bits;				///< Eventos sinalizados
+	uint32_t			pendentes;			///< Eventos sinalizados por interrupcao, ainda nao processados
+	lista_bloqueio_t	esperando;			///< Tarefas esperando eventos, por prioridade
+	struct eventos_s	*proximo_pendente;	///< Proximo grupo com eventos pendentes
+} eventos_t;
+
+#ifdef cfg_TABELA_DE_TAREFAS
+/******************************************************************/
+/* tabela estatica de tarefas
+
+   Em conf_rtos.h, a tabela lista as tarefas na ordem de criacao:
+
+   #define cfg_TABELA_DE_TAREFAS(TAREFA)							\
+		TAREFA(tarefa_1, "Tarefa 1", TAM_MINIMO_PILHA + 24, 2)		\
+		TAREFA(tarefa_ociosa, "Tarefa ociosa", TAM_MINIMO_PILHA + 24, 0)
+
+   As pilhas e a tabela (constante) sao geradas pelo nucleo e as tarefas sao
+   criadas por IniciaMultitarefas(), sem chamadas de CriaTarefa(). O numero 
+   de cada tarefa e ID_<funcao> (ex. ID_tarefa_1). Pilhas menores que 
+   TAM_MINIMO_PILHA, prioridades maiores que PRIORIDADE_MAXIMA e, com 
+   cfg_PRIORIDADES_UNICAS, prioridades repetidas (escritas como numeros) 
+   sao erros de compilacao. */
+
+/* erro de compilacao (tamanho de vetor negativo) se a condicao for falsa */
+#define VERIFICA_ESTATICA(condicao, nome)	typedef char nome[(condicao) ? 1 : -1]
+
+#define TABELA_PROTOTIPO(tarefa, nome, tamanho, prioridade)		void tarefa(void);
+#define TABELA_ID(tarefa, nome, tamanho, prioridade)			ID_##tarefa,
+#define TABELA_VERIFICA(tarefa, nome, tamanho, prioridade)						\
+	VERIFICA_ESTATICA((tamanho) >= TAM_MINIMO_PILHA, pilha_pequena_##tarefa);		\
+	VERIFICA_ESTATICA((prioridade) <= PRIORIDADE_MAXIMA, prioridade_invalida_##tarefa);
+#define TABELA_PRIORIDADE(tarefa, nome, tamanho, prioridade)	prioridade_repetida_##prioridade,
+
+cfg_TABELA_DE_TAREFAS(TABELA_PROTOTIPO)
+
+enum
+{
+	ID_NENHUMA_TAREFA = 0,
+	cfg_TABELA_DE_TAREFAS(TABELA_ID)
+	ID_FIM_DA_TABELA
+};
+
+cfg_TABELA_DE_TAREFAS(TABELA_VERIFICA)
+VERIFICA_ESTATICA(ID_FIM_DA_TABELA - 1 <= NUMERO_DE_TAREFAS, tabela_maior_que_NUMERO_DE_TAREFAS);
+
+#if cfg_PRIORIDADES_UNICAS
+/* uma prioridade repetida define a mesma constante duas vezes */
+enum
+{
+	cfg_TABELA_DE_TAREFAS(TABELA_PRIORIDADE)
+	prioridade_repetida_fim
+};
+#endif
+
+/**
+* \struct tarefa_tabela_t
+* Entrada da tabela estatica de tarefas
+*/
+
+typedef struct
+{
+	tarefa_t		tarefa;			///< Funcao da tarefa
+	const char		*nome;			///< Nome da tarefa
+	stackptr_t		pilha;			///< Area da pilha
+	uint16_t		tamanho;		///< Tamanho da pilha em palavras
+	prioridade_t	prioridade;		///< Prioridade da tarefa
+} tarefa_tabela_t;
+#endif
+
+void tarefa_ociosa(void);
+uint8_t escalonador(void);
+
+void TrocaContextoDasTarefas(void);
+uint8_t TrocaContextoNecessaria(void);
+void TrocaContextoSeNecessario(void);
+void TrocaContextoSeNecessarioISR(void);
+void TrocasDeContexto(trocas_contexto_t *trocas);
+
+#if cfg_MEDIDAS_REGIAO_ATOMICA
+uint8_t RegioesAtomicasMedidas(regiao_medida_t *medidas, uint8_t maximo);
+void RegioesAtomicasZera(void);
+#endif
+
+#if cfg_ESTATISTICAS
+void TarefaEstatisticas(uint8_t id_tarefa, estatisticas_tarefa_t *estatisticas);
+#endif
+
+#if cfg_MEDIDAS_LATENCIA
+void LatenciasTarefa(uint8_t id_tarefa, latencia_t *troca, latencia_t *isr);
+uint16_t LatenciasRecentes(amostra_latencia_t *amostras, uint16_t maximo);
+void LatenciasZera(void);
+#endif
+uint32_t * CriaContexto(tarefa_t endereco_tarefa, uint32_t* ptr_pilha);
+uint8_t CriaTarefa(tarefa_t p, const char * nome, stackptr_t pilha, uint16_t tamanho, prioridade_t prioridade);
+uint8_t CriaTarefaDinamica(tarefa_t p, const char * nome, prioridade_t prioridade);
+#if cfg_EDF
+uint8_t CriaTarefaEDF(tarefa_t p, const char * nome, stackptr_t pilha, uint16_t tamanho, 
+						tick_t periodo, tick_t prazo);
+void TarefaAguardaPeriodo(void);
+#endif
+#if cfg_EDF || cfg_ORCAMENTOS
+uint32_t TarefaPerdasDePrazo(uint8_t id_tarefa);
+#endif
+#if cfg_RASTRO
+extern rastro_t rastro;
+void RastroInicia(void);
+void RastroPara(void);
+#endif
+#if cfg_ORCAMENTOS
+void TarefaOrcamento(uint8_t id_tarefa, tick_t qtas_marcas, uint8_t acao);
+uint32_t TarefaEstouros(uint8_t id_tarefa);
+uint16_t OcorrenciasRecentes(ocorrencia_t *ocorrencias, uint16_t maximo);
+#endif
+void TarefaTermina(void);
+resultado_t TarefaApaga(uint8_t id_tarefa);
+void IniciaMultitarefas(void);
+void ConfiguraMarcaTempo(void);
+uint8_t ExecutaMarcaDeTempo(void);
+void AvancaMarcasDeTempo(tick_t qtas_marcas);
+tick_t DormeSemMarcaDeTempo(tick_t qtas_marcas);
+uint32_t LeCiclos(void);
+uint32_t MarcasDeTempoOmitidas(void);
+#if cfg_MODO_SEM_MARCA
+void DormeAteProximoDespertar(void);
+#endif
+
+void TarefaSuspende(uint8_t id_tarefa);
+void TarefaContinua(uint8_t id_tarefa);
+void TarefaEspera(tick_t qtas_marcas);
+void TarefaQuantum(uint8_t id_tarefa, tick_t qtas_marcas);
+void TarefaEsperaAte(tick_t *ultimo_despertar, tick_t periodo);
+uint16_t TarefaPilhaLivre(uint8_t id_tarefa);
+void EstouroDePilha(uint8_t id_tarefa);
+
+tick_t MarcasDeTempo(void);
+uint64_t MarcasDeTempo64(void);
+
+void SemaforoAguarda(semaforo_t* sem);
+resultado_t SemaforoAguardaTempo(semaforo_t* sem, tick_t qtas_marcas);
+void SemaforoLibera(semaforo_t* sem);
+void SemaforoLiberaISR(semaforo_t* sem);
+
+#if cfg_TRABALHOS_ISR
+resultado_t TrabalhoISR(trabalho_t funcao, void *argumento);
+void TarefaTrabalhos(void);
+#endif
+
+#if cfg_TEMPORIZADORES
+void TemporizadorCria(temporizador_t* temporizador, trabalho_t funcao, void *argumento);
+void TemporizadorInicia(temporizador_t* temporizador, tick_t qtas_marcas, tick_t periodo);
+void TemporizadorPara(temporizador_t* temporizador);
+uint8_t TemporizadorAtivo(temporizador_t* temporizador);
+void TarefaTemporizadores(void);
+#endif
+
+void MutexTrava(mutex_t* mutex);
+resultado_t MutexTravaTempo(mutex_t* mutex, tick_t qtas_marcas);
+void MutexLibera(mutex_t* mutex);
+
+void FilaCria(fila_t* fila, void* buffer, uint16_t tamanho, uint16_t capacidade);
+resultado_t FilaEnvia(fila_t* fila, const void* mensagem, tick_t qtas_marcas);
+resultado_t FilaRecebe(fila_t* fila, void* mensagem, tick_t qtas_marcas);
+resultado_t FilaEnviaISR(fila_t* fila, const void* mensagem);
+resultado_t FilaRecebeISR(fila_t* fila, void* mensagem);
+resultado_t FilaEnviaPonteiro(fila_t* fila, void* ponteiro, tick_t qtas_marcas);
+resultado_t FilaRecebePonteiro(fila_t* fila, void** ponteiro, tick_t qtas_marcas);
+uint16_t FilaQuantidade(fila_t* fila);
+
+resultado_t EventosAguarda(eventos_t* eventos, uint32_t mascara, uint8_t opcoes, 
+							uint32_t* recebidos, tick_t qtas_marcas);
+void EventosSinaliza(eventos_t* eventos, uint32_t bits);
+void EventosSinalizaISR(eventos_t* eventos, uint32_t bits);
+void EventosLimpa(eventos_t* eventos, uint32_t bits);
+#endif /* MULTITAREFAS_H_ */
\ No newline at end of file
@@ -16,6 +16,12 @@
 
 /* tipo do ponteiro de pilha */
 typedef uint32_t* stackptr_t;
+#define SP_TYPECAST  uint32_t
+
+/* estimativa dos ciclos (Cortex-M0+, sem estados de espera) da interrupcao 
+   PendSV completa e somente do salvamento e restauracao de R4-R11 e do SP */
+#define CICLOS_TROCA_CONTEXTO	110
+#define CICLOS_SALVA_RESTAURA	45
 
 
 /* registradores da cpu ARM Cortex-M*/
@@ -23,12 +29,16 @@ typedef uint32_t* stackptr_t;
 #define NVIC_SYSPRI3			( ( volatile unsigned long *) 0xe000ed20 )
 #define NVIC_SYSTICK_CTRL       ( ( volatile unsigned long *) 0xe000e010 )
 #define NVIC_SYSTICK_LOAD       ( ( volatile unsigned long *) 0xe000e014 )
+#define NVIC_SYSTICK_VAL        ( ( volatile unsigned long *) 0xe000e018 )
 
 #define NVIC_PENDSVSET      			0x10000000         			// Dispara excecao PendSV
 #define NVIC_PENDSVCLR      			0x08000000         			// Limpa a flag PendSV
+#define NVIC_PENDSTSET      			0x04000000         			// SysTick pendente
 #define NVIC_SYSTICK_CLK        		0x00000004
 #define NVIC_SYSTICK_INT        		0x00000002
 #define NVIC_SYSTICK_ENABLE     		0x00000001
+#define NVIC_SYSTICK_COUNTFLAG  		0x00010000
+#define NVIC_SYSTICK_MAXIMO     		0x00FFFFFF         			// contador de 24 bits
 #define PRIO_BITS       		        4        					// 15 niveis de prioridade
 #define LOWEST_INTERRUPT_PRIORITY		0xF
 #define KERNEL_INTERRUPT_PRIORITY 		(LOWEST_INTERRUPT_PRIORITY << (8 - PRIO_BITS) )
@@ -37,13 +47,19 @@ typedef uint32_t* stackptr_t;
 
 
 /* macros dependentes de hardware, instrucoes em assembly */
-#define REG_ATOMICA_INICIO()  	  __asm(" CPSID I");
-#define REG_ATOMICA_FIM()  		  __asm(" CPSIE I");
+/* regiao critica: REG_ATOMICA_INICIO() e REG_ATOMICA_FIM() (rtos.h) usam
+   PortEntraRegiaoAtomica() e PortSaiRegiaoAtomica(), que salvam e restauram
+   o PRIMASK (o Cortex-M0+ nao possui BASEPRI) */
+void PortEsperaTrocaContexto(void);
 
-#define TROCA_CONTEXTO()		*(NVIC_INT_CTRL_B) = NVIC_PENDSVSET; __asm(" CPSIE I");
+#define TROCA_CONTEXTO()		*(NVIC_INT_CTRL_B) = NVIC_PENDSVSET; PortEsperaTrocaContexto();
 #define TrocaContexto()		    TROCA_CONTEXTO()
+#define PEDE_TROCA_CONTEXTO()	*(NVIC_INT_CTRL_B) = NVIC_PENDSVSET;	/* somente solicita a PendSV */
 #define Clear_PendSV(void)		*(NVIC_INT_CTRL_B) = NVIC_PENDSVCLR
 
+/* coloca o processador para dormir ate a proxima interrupcao */
+#define DORME_CPU()			system_set_sleepmode(SYSTEM_SLEEPMODE_IDLE_0); system_sleep();	/* WFI pelo driver de energia (power.h) */
+
 #define GERA_INTERRUPCAO_SW()      __asm(  /* Call SVC to start the first task. */		\
 										"cpsie i				\n"					\
 										"svc 0					\n"					\
@@ -97,5 +113,19 @@ typedef uint32_t* stackptr_t;
 								"BX      R1               	\n"						  \
 							)
 
+/* retorno da PendSV, antes de salvar o contexto, quando 
+   TrocaContextoNecessaria() retorna 0. Feito em assembly: a chamada preserva
+   R4-R11 da tarefa e o retorno usa EXC_RETURN fixo, entao o LR sobrescrito
+   pelo BL nao e usado */
+#define RETORNA_SE_DESNECESSARIA()	__asm volatile(							  \
+								"BL      TrocaContextoNecessaria	\n"		  \
+								"CMP     R0, #0				\n"			  \
+								"BNE     1f					\n"			  \
+								"LDR     R1,=0xFFFFFFFD     \n"			  \
+								"CPSIE   I					\n"			  \
+								"BX      R1               	\n"			  \
+								"1:							\n"			  \
+							)
+
 
 #endif /* CPU_PORT_H_ */
\ No newline at end of file
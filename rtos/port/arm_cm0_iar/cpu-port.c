@@ -0,0 +1,270 @@
+/*
+ * cpu_port.c
+ *
+ * Author: Carlos H. Barriquello
+ */ 
+
+#include "cpu-port.h"
+#include "rtos.h"
+
+extern SP_TYPECAST	   SP;
+
+stackptr_t CriaContexto(tarefa_t endereco_tarefa, stackptr_t ptr_pilha)
+{
+	#define INITIAL_XPSR		0x01000000
+	
+	uint32_t reg_val;
+	*(--ptr_pilha) = INITIAL_XPSR;     /* xPSR */
+	*(--ptr_pilha) = (uint32_t)endereco_tarefa;  /* R15 */
+	*(--ptr_pilha) = (uint32_t)TarefaTermina;	/* R14: o retorno da tarefa termina a tarefa */
+	
+	*(--ptr_pilha) = 0x12;			   /* R12 */
+	
+	for(reg_val = 3; reg_val > 0; reg_val--)
+	{
+		*(--ptr_pilha) = reg_val;  /* R3, R2, R1 */
+	}
+	
+	*(--ptr_pilha) = 0;		   /* R0 */
+	
+	for(reg_val = 7; reg_val >= 4; reg_val--)
+	{
+		*(--ptr_pilha) = reg_val;  /* R7, R6, R5, R4 */
+	}
+	
+	for(reg_val = 11; reg_val >= 8; reg_val--)
+	{
+		*(--ptr_pilha) = reg_val;  /* R11, R10, R9, R8 */
+	}
+	
+	return ptr_pilha;
+
+	
+}
+
+/* entrada na regiao critica: desabilita as interrupcoes e, na regiao mais 
+ * externa, guarda se elas ja estavam desabilitadas (PRIMASK) */
+void PortEntraRegiaoAtomica(void)
+{
+	uint32_t primask;
+
+	__asm volatile("MRS %0, PRIMASK" : "=r"(primask));
+	__asm volatile(" CPSID I" ::: "memory");
+
+	if((regiao_atomica & REGIAO_ANINHAMENTO) == 0)
+	{
+		regiao_atomica = (primask & 1) ? REGIAO_DESABILITADAS : 0;
+	}
+	regiao_atomica++;
+}
+
+/* saida da regiao critica: so habilita as interrupcoes na saida da regiao 
+ * mais externa e se elas estavam habilitadas na entrada */
+void PortSaiRegiaoAtomica(void)
+{
+	if(--regiao_atomica == 0)
+	{
+		__asm volatile(" CPSIE I" ::: "memory");
+	}
+}
+
+/* troca de contexto solicitada (PendSV pendente): habilita as interrupcoes 
+ * para a PendSV executar e, se a tarefa estava em uma regiao critica, 
+ * desabilita de novo quando ela volta a executar. Durante a janela com as
+ * interrupcoes habilitadas o contador de regioes fica zerado: uma 
+ * interrupcao que usa os servicos entra e sai da sua propria regiao e 
+ * retorna com as interrupcoes habilitadas, sem impedir a PendSV. O contador
+ * da tarefa fica na pilha e e restaurado com as interrupcoes desabilitadas,
+ * e a medida da regiao critica fica parada durante a janela */
+void PortEsperaTrocaContexto(void)
+{
+	uint32_t regiao = regiao_atomica;
+#if cfg_MEDIDAS_REGIAO_ATOMICA
+	uint32_t ciclos = RegiaoAtomicaPausa();
+#endif
+
+	regiao_atomica = 0;
+	__asm volatile(" CPSIE I" ::: "memory");
+	__asm volatile(" ISB");
+	if((regiao & REGIAO_ANINHAMENTO) != 0)
+	{
+		__asm volatile(" CPSID I" ::: "memory");
+	}
+	regiao_atomica = regiao;
+#if cfg_MEDIDAS_REGIAO_ATOMICA
+	RegiaoAtomicaRetoma(ciclos);
+#endif
+}
+
+/* numero de ciclos do SysTick por marca de tempo */
+static uint32_t ciclos_por_marca;
+
+/* Codigo dependente de hardware usado para 
+ * configuracao da marca de tempo do sistema multitarefas */
+void ConfiguraMarcaTempo(void)
+{   
+	
+                uint32_t cpu_clock_hz = cfg_CPU_CLOCK_HZ;
+		uint16_t valor_comparador = cpu_clock_hz/cfg_MARCA_TEMPO_HZ; //(cfg_CPU_CLOCK_HZ / cfg_MARCA_TEMPO_HZ);
+		
+		ciclos_por_marca = valor_comparador;
+		*(NVIC_SYSTICK_CTRL) = 0;						// Desabilita SysTick Timer
+		*(NVIC_SYSTICK_LOAD) = valor_comparador - 1;	// Configura a contagem
+		*(NVIC_SYSTICK_CTRL) = NVIC_SYSTICK_CLK | NVIC_SYSTICK_INT | NVIC_SYSTICK_ENABLE;  // Inicia
+}
+
+/* contador de ciclos para as medidas de latencia. O Cortex-M0+ nao possui o 
+ * contador de ciclos do DWT, entao os ciclos sao formados pelas marcas de 
+ * tempo e pelo valor atual do SysTick (contador decrescente). Os valores 
+ * nao sao validos no modo sem marcas, que muda a recarga do SysTick */
+uint32_t LeCiclos(void)
+{
+	tick_t inicio, marcas;
+	uint32_t valor;
+
+	/* repete se a interrupcao do SysTick contar uma marca durante a leitura */
+	do
+	{
+		inicio = MarcasDeTempo();
+		marcas = inicio;
+		valor = *(NVIC_SYSTICK_VAL);
+		if(*(NVIC_INT_CTRL_B) & NVIC_PENDSTSET)
+		{
+			/* o SysTick ja deu a volta, mas a marca ainda nao foi contada */
+			valor = *(NVIC_SYSTICK_VAL);
+			marcas++;
+		}
+	}while(inicio != MarcasDeTempo());
+
+	return (uint32_t)marcas * ciclos_por_marca + (ciclos_por_marca - 1 - valor);
+}
+
+/* Modo sem marcas de tempo: reprograma o SysTick para interromper somente 
+ * depois de qtas_marcas (0 = o maximo possivel) e coloca o processador para 
+ * dormir. Deve ser chamada com as interrupcoes bloqueadas. Retorna o numero 
+ * de marcas completas que passaram e que nao foram contadas pela interrupcao 
+ * do SysTick, para a correcao do contador de marcas. */
+tick_t DormeSemMarcaDeTempo(tick_t qtas_marcas)
+{
+	uint32_t maximo, recarga, restante, nao_passadas;
+	tick_t passadas;
+
+	if((*(NVIC_SYSTICK_CTRL) & NVIC_SYSTICK_ENABLE) == 0)
+	{
+		return 0;		/* marca de tempo nao configurada */
+	}
+
+	maximo = NVIC_SYSTICK_MAXIMO / ciclos_por_marca;
+
+	if(qtas_marcas == 0 || qtas_marcas > maximo)
+	{
+		qtas_marcas = (tick_t)maximo;
+	}
+
+	/* para o SysTick; a marca em andamento termina em NVIC_SYSTICK_VAL ciclos */
+	*(NVIC_SYSTICK_CTRL) = NVIC_SYSTICK_CLK | NVIC_SYSTICK_INT;
+
+	if(*(NVIC_INT_CTRL_B) & NVIC_PENDSTSET)
+	{
+		/* uma marca ja esta pendente, nao dorme */
+		*(NVIC_SYSTICK_CTRL) = NVIC_SYSTICK_CLK | NVIC_SYSTICK_INT | NVIC_SYSTICK_ENABLE;
+		return 0;
+	}
+
+	recarga = *(NVIC_SYSTICK_VAL) + (ciclos_por_marca * (qtas_marcas - 1));
+	*(NVIC_SYSTICK_LOAD) = recarga - 1;
+	*(NVIC_SYSTICK_VAL) = 0;
+	*(NVIC_SYSTICK_CTRL) = NVIC_SYSTICK_CLK | NVIC_SYSTICK_INT | NVIC_SYSTICK_ENABLE;
+
+	DORME_CPU();
+
+	*(NVIC_SYSTICK_CTRL) = NVIC_SYSTICK_CLK | NVIC_SYSTICK_INT;
+
+	if(*(NVIC_SYSTICK_CTRL) & NVIC_SYSTICK_COUNTFLAG)
+	{
+		/* dormiu ate o fim: a ultima marca sera contada pela interrupcao
+		 * pendente do SysTick, e a proxima marca desconta o que ja passou */
+		restante = ciclos_por_marca - (recarga - *(NVIC_SYSTICK_VAL));
+		if(restante == 0 || restante > ciclos_por_marca)
+		{
+			restante = ciclos_por_marca;
+		}
+		passadas = qtas_marcas - 1;
+	}else
+	{
+		/* acordou antes por outra interrupcao: conta as marcas que passaram 
+		 * e programa o restante da marca em andamento */
+		restante = *(NVIC_SYSTICK_VAL);
+		if(restante == 0)
+		{
+			restante = 1;
+		}
+		nao_passadas = (restante + ciclos_por_marca - 1) / ciclos_por_marca;
+		passadas = (tick_t)(qtas_marcas - nao_passadas);
+		restante = restante - ((nao_passadas - 1) * ciclos_por_marca);
+	}
+
+	/* reinicia o SysTick com o restante da marca atual e volta ao periodo normal */
+	*(NVIC_SYSTICK_LOAD) = restante - 1;
+	*(NVIC_SYSTICK_VAL) = 0;
+	*(NVIC_SYSTICK_CTRL) = NVIC_SYSTICK_CLK | NVIC_SYSTICK_INT | NVIC_SYSTICK_ENABLE;
+	*(NVIC_SYSTICK_LOAD) = ciclos_por_marca - 1;
+
+	return passadas;
+}
+
+/* rotinas de interrupo necessrias */
+__irq __attribute__ ((naked)) void SVC_Handler(void)
+{
+	/* Make PendSV and SysTick the lowest priority interrupts. */
+	*(NVIC_SYSPRI3) |= NVIC_PENDSV_PRI;
+	*(NVIC_SYSPRI3) |= NVIC_SYSTICK_PRI;
+	RESTAURA_SP(SP);
+	RESTAURA_CONTEXTO();
+	RESTAURA_ISR();
+}
+
+__irq __attribute__ ((naked)) void PendSV_Handler(void)
+{
+	/* o escalonador manteve a tarefa atual: retorna sem salvar e restaurar o
+	 * contexto. Sem codigo C antes de SALVA_CONTEXTO na rotina naked */
+	RETORNA_SE_DESNECESSARIA();
+	
+
+	SALVA_ISR();
+	SALVA_CONTEXTO();
+	SALVA_SP(SP);
+	
+	Clear_PendSV();
+	
+        TrocaContextoDasTarefas();
+	
+	RESTAURA_SP(SP);
+	RESTAURA_CONTEXTO();
+	RESTAURA_ISR();
+	
+}
+
+/* Codigo dependente de hardware usado para 
+   realizar a marca de tempo do sistema multitarefas - interrupcao */
+__irq void SysTick_Handler(void)
+{	
+	 
+	 ExecutaMarcaDeTempo();
+	 #if cfg_PREEMPTIVO
+	 TrocaContextoSeNecessarioISR();   /* modos preemptivos (cfg_MODO_ESCALONAMENTO), inclusive o rodizio */
+	 #endif
+}
+
+__irq void HardFault_Handler(void)
+{
+	
+	while(1)
+	{
+		
+		
+	}
+}
+
+
+
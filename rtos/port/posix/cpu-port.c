@@ -0,0 +1,315 @@
+/*
+ * cpu_port.c
+ *
+ * Porta do sistema multitarefas para Linux/POSIX (simulacao no computador).
+ */
+
+#include <signal.h>
+#include <string.h>
+#include <sys/time.h>
+#include <time.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+#include "cpu-port.h"
+#include "rtos.h"
+
+extern SP_TYPECAST	   SP;
+
+/* contexto da tarefa, guardado no topo da sua pilha. O ponteiro de pilha
+   (SP) da tarefa e o endereco deste contexto */
+typedef struct
+{
+	ucontext_t	contexto;
+	tarefa_t	tarefa;
+} contexto_t;
+
+/* interrupcoes simuladas: 1 = habilitadas */
+static volatile sig_atomic_t interrupcoes = 0;
+
+/* marca de tempo que chegou com as interrupcoes desabilitadas */
+static volatile sig_atomic_t marca_pendente = 0;
+
+/* troca de contexto solicitada, feita quando as interrupcoes sao habilitadas
+   (equivalente a PendSV pendente) */
+static volatile sig_atomic_t troca_pendente = 0;
+
+/* interrupcao simulada pendente (PortInterrupcaoSimulada()) e indicacao de
+   execucao dentro dela: como no hardware, a troca de contexto pedida pela 
+   interrupcao so e feita na sua saida */
+static void (*volatile isr_pendente)(void) = 0;
+static volatile sig_atomic_t em_isr = 0;
+
+/* entrada das tarefas: habilita as interrupcoes, como na saida da PendSV. 
+ * O retorno da tarefa termina a tarefa */
+static void IniciaTarefa(void)
+{
+	contexto_t *contexto = (contexto_t*)SP;
+
+	PortHabilitaInterrupcoes();
+	contexto->tarefa();
+	TarefaTermina();
+}
+
+stackptr_t CriaContexto(tarefa_t endereco_tarefa, stackptr_t ptr_pilha)
+{
+	uint8_t *topo = (uint8_t*)ptr_pilha;
+	uint8_t *base = topo - TAM_MINIMO_PILHA * sizeof(uint32_t);
+	contexto_t *contexto;
+
+	/* contexto alinhado em 16 bytes no topo da pilha */
+	contexto = (contexto_t*)(((uintptr_t)topo - sizeof(contexto_t)) & ~(uintptr_t)0xF);
+
+	getcontext(&contexto->contexto);
+	contexto->tarefa = endereco_tarefa;
+	contexto->contexto.uc_stack.ss_sp = base;
+	contexto->contexto.uc_stack.ss_size = (size_t)((uint8_t*)contexto - base);
+	contexto->contexto.uc_link = 0;
+	makecontext(&contexto->contexto, IniciaTarefa, 0);
+
+	return (stackptr_t)contexto;
+}
+
+/* tratamento da marca de tempo, equivalente ao SysTick_Handler */
+static void TrataMarcaDeTempo(void)
+{
+	interrupcoes = 0;
+	marca_pendente = 0;
+
+	ExecutaMarcaDeTempo();
+#if cfg_PREEMPTIVO
+	TrocaContextoSeNecessarioISR();   /* modos preemptivos (cfg_MODO_ESCALONAMENTO), inclusive o rodizio */
+#endif
+	PortHabilitaInterrupcoes();
+}
+
+static void SinalMarcaDeTempo(int sinal)
+{
+	(void)sinal;
+
+	marca_pendente = 1;
+	if(interrupcoes && !em_isr)
+	{
+		TrataMarcaDeTempo();
+	}
+}
+
+void PortDesabilitaInterrupcoes(void)
+{
+	interrupcoes = 0;
+}
+
+void PortHabilitaInterrupcoes(void)
+{
+	void (*isr)(void) = isr_pendente;
+
+	interrupcoes = 1;
+	if(em_isr)
+	{
+		return;
+	}
+	if(isr != 0)
+	{
+		/* executa com as interrupcoes habilitadas e o contador de regioes da
+		 * tarefa interrompida, como uma interrupcao de periferico. O PRIMASK
+		 * nao e restaurado no retorno da interrupcao: se ela deixar as 
+		 * interrupcoes desabilitadas, a troca pendente nao e feita */
+		isr_pendente = 0;
+		em_isr = 1;
+		isr();
+		em_isr = 0;
+		if(!interrupcoes)
+		{
+			return;
+		}
+	}
+	if(marca_pendente)
+	{
+		TrataMarcaDeTempo();
+	}else if(troca_pendente)
+	{
+		PortTrocaContexto();
+	}
+}
+
+/* entrada na regiao critica: na regiao mais externa, guarda se as 
+ * interrupcoes ja estavam desabilitadas */
+void PortEntraRegiaoAtomica(void)
+{
+	sig_atomic_t habilitadas = interrupcoes;
+
+	interrupcoes = 0;
+
+	if((regiao_atomica & REGIAO_ANINHAMENTO) == 0)
+	{
+		regiao_atomica = habilitadas ? 0 : REGIAO_DESABILITADAS;
+	}
+	regiao_atomica++;
+}
+
+/* saida da regiao critica: so habilita as interrupcoes na saida da regiao
+ * mais externa e se elas estavam habilitadas na entrada */
+void PortSaiRegiaoAtomica(void)
+{
+	if(--regiao_atomica == 0)
+	{
+		PortHabilitaInterrupcoes();
+	}
+}
+
+/* somente solicita a troca de contexto, feita ao habilitar as interrupcoes */
+void PortPedeTrocaContexto(void)
+{
+	troca_pendente = 1;
+	if(interrupcoes && !em_isr)
+	{
+		PortTrocaContexto();
+	}
+}
+
+/* equivalente a PortEsperaTrocaContexto das portas ARM: habilita as 
+ * interrupcoes para a troca pendente e, se a tarefa estava em uma regiao 
+ * critica, desabilita de novo quando ela volta a executar. Na janela o 
+ * contador de regioes fica zerado, para as interrupcoes que usam os 
+ * servicos retornarem com as interrupcoes habilitadas, e a medida da regiao
+ * critica fica parada */
+void PortEsperaTrocaContexto(void)
+{
+	uint32_t regiao = regiao_atomica;
+#if cfg_MEDIDAS_REGIAO_ATOMICA
+	uint32_t ciclos = RegiaoAtomicaPausa();
+#endif
+
+	regiao_atomica = 0;
+	PortHabilitaInterrupcoes();
+	if((regiao & REGIAO_ANINHAMENTO) != 0)
+	{
+		PortDesabilitaInterrupcoes();
+	}
+	regiao_atomica = regiao;
+#if cfg_MEDIDAS_REGIAO_ATOMICA
+	RegiaoAtomicaRetoma(ciclos);
+#endif
+}
+
+/* agenda uma interrupcao simulada, executada quando as interrupcoes forem 
+ * habilitadas (para os testes das janelas com interrupcoes habilitadas) */
+void PortInterrupcaoSimulada(void (*isr)(void))
+{
+	isr_pendente = isr;
+}
+
+/* equivalente a PendSV_Handler: o escalonador escolhe a proxima tarefa e o
+   contexto e trocado somente se ela for diferente da tarefa atual. Ao 
+   retornar, as interrupcoes continuam desabilitadas se a tarefa que volta a
+   executar esta em uma regiao critica */
+void PortTrocaContexto(void)
+{
+	contexto_t *atual;
+
+	interrupcoes = 0;
+	troca_pendente = 0;
+
+	if(TrocaContextoNecessaria() != 0)
+	{
+		atual = (contexto_t*)SP;
+		TrocaContextoDasTarefas();
+
+		if((contexto_t*)SP != atual)
+		{
+			swapcontext(&atual->contexto, &((contexto_t*)SP)->contexto);
+		}
+	}
+
+	if((regiao_atomica & REGIAO_ANINHAMENTO) == 0)
+	{
+		PortHabilitaInterrupcoes();
+	}
+}
+
+void PortIniciaMultitarefas(void)
+{
+	setcontext(&((contexto_t*)SP)->contexto);
+}
+
+/* Codigo dependente de hardware usado para
+ * configuracao da marca de tempo do sistema multitarefas */
+void ConfiguraMarcaTempo(void)
+{
+#if cfg_MARCA_TEMPO_REAL
+	struct sigaction acao;
+	struct itimerval periodo;
+
+	memset(&acao, 0, sizeof(acao));
+	acao.sa_handler = SinalMarcaDeTempo;
+	sigemptyset(&acao.sa_mask);
+	acao.sa_flags = SA_RESTART;
+	sigaction(SIGALRM, &acao, 0);
+
+	periodo.it_interval.tv_sec = 0;
+	periodo.it_interval.tv_usec = 1000000 / cfg_MARCA_TEMPO_HZ;
+	periodo.it_value = periodo.it_interval;
+	setitimer(ITIMER_REAL, &periodo, 0);
+#else
+	(void)SinalMarcaDeTempo;		/* marca de tempo simulada, sem sinal */
+#endif
+}
+
+/* chamada pela tarefa ociosa: com a marca de tempo simulada, o tempo avanca
+ * uma marca; com a marca de tempo real, espera o proximo sinal */
+void EsperaMarcaDeTempo(void)
+{
+#if cfg_MARCA_TEMPO_REAL
+	pause();
+#else
+	TrataMarcaDeTempo();
+#endif
+}
+
+/* modo sem marcas de tempo: como no SysTick, a ultima das qtas_marcas e 
+ * contada pela marca pendente, tratada ao habilitar as interrupcoes (marca 
+ * real) ou pela EsperaMarcaDeTempo() seguinte da tarefa ociosa (marca 
+ * simulada). Retorna as marcas omitidas. Com a marca de tempo simulada, o 
+ * tempo salta direto para o proximo despertar */
+tick_t DormeSemMarcaDeTempo(tick_t qtas_marcas)
+{
+#if cfg_MARCA_TEMPO_REAL
+	struct itimerval periodo;
+	uint64_t us;
+
+	if(marca_pendente)
+	{
+		return 0;		/* uma marca ja esta pendente, nao dorme */
+	}
+	if(qtas_marcas == 0)
+	{
+		pause();		/* sem despertar programado: dorme ate a proxima marca */
+		return 0;
+	}
+
+	/* um unico sinal depois de qtas_marcas periodos, seguido do periodo
+	 * normal. A fase das marcas passa a contar deste instante */
+	getitimer(ITIMER_REAL, &periodo);
+	us = (uint64_t)periodo.it_interval.tv_usec * qtas_marcas;
+	periodo.it_value.tv_sec = (time_t)(us / 1000000u);
+	periodo.it_value.tv_usec = (suseconds_t)(us % 1000000u);
+	setitimer(ITIMER_REAL, &periodo, 0);
+
+	while(!marca_pendente)
+	{
+		pause();
+	}
+	return qtas_marcas - 1;
+#else
+	return qtas_marcas > 0 ? qtas_marcas - 1 : 0;
+#endif
+}
+
+/* contador para as medidas de latencia: no computador, em nanossegundos */
+uint32_t LeCiclos(void)
+{
+	struct timespec agora;
+
+	clock_gettime(CLOCK_MONOTONIC, &agora);
+	return (uint32_t)((uint64_t)agora.tv_sec * 1000000000u + (uint64_t)agora.tv_nsec);
+}
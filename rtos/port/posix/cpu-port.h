@@ -0,0 +1,54 @@
+/*
+ * cpu_port.h
+ *
+ * Porta do sistema multitarefas para Linux/POSIX (simulacao no computador).
+ * As tarefas sao contextos ucontext_t, as interrupcoes sao simuladas por uma
+ * variavel e a marca de tempo e simulada ou gerada pelo sinal SIGALRM.
+ */
+
+
+#ifndef CPU_PORT_H_
+#define CPU_PORT_H_
+
+#include <stdint.h>
+
+/* marca de tempo: 0 = simulada (deterministica, o tempo so avanca quando
+   todas as tarefas estao bloqueadas), 1 = tempo real (sinal SIGALRM) */
+#ifndef cfg_MARCA_TEMPO_REAL
+#define cfg_MARCA_TEMPO_REAL	0
+#endif
+
+/* configurar conforme processador*/
+/* o contexto (ucontext_t) fica no topo da pilha da tarefa e o restante e a
+   pilha usada pelo codigo C no computador, entao o minimo e bem maior */
+#define TAM_MINIMO_PILHA  (4096)
+
+/* tipo do ponteiro de pilha */
+typedef uint32_t* stackptr_t;
+#define SP_TYPECAST  uintptr_t
+
+/* LeCiclos() conta nanossegundos */
+#define CICLOS_POR_US	1000
+
+/* funcoes da porta, no lugar das instrucoes em assembly */
+void PortDesabilitaInterrupcoes(void);
+void PortHabilitaInterrupcoes(void);
+void PortTrocaContexto(void);
+void PortPedeTrocaContexto(void);
+void PortEsperaTrocaContexto(void);
+void PortIniciaMultitarefas(void);
+void EsperaMarcaDeTempo(void);
+void PortInterrupcaoSimulada(void (*isr)(void));
+
+/* macros dependentes de hardware (a regiao critica, REG_ATOMICA_INICIO() e
+   REG_ATOMICA_FIM(), usa PortEntraRegiaoAtomica() e PortSaiRegiaoAtomica()) */
+#define TROCA_CONTEXTO()	    PortPedeTrocaContexto(); PortEsperaTrocaContexto();
+#define TrocaContexto()		    TROCA_CONTEXTO()
+#define PEDE_TROCA_CONTEXTO()	    PortPedeTrocaContexto();
+
+/* coloca o processador para dormir ate a proxima interrupcao */
+#define DORME_CPU()			EsperaMarcaDeTempo();
+
+#define GERA_INTERRUPCAO_SW()      PortIniciaMultitarefas();
+
+#endif /* CPU_PORT_H_ */
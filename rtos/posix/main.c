@@ -0,0 +1,1525 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "rtos.h"
+
+/*
+ * Medidas de desempenho do sistema multitarefas no computador
+ */
+#define NUM_ITERACOES	100000
+
+/*
+ * As tarefas e as pilhas sao definidas pela tabela de tarefas de conf_rtos.h
+ */
+
+semaforo_t SemaforoIda = {0};
+semaforo_t SemaforoVolta = {0};
+
+/* o contador de marcas comeca MARCAS_ANTES_DA_VOLTA marcas antes de dar a 
+ * volta nos 32 bits: os testes e as medidas atravessam a volta */
+#define MARCAS_ANTES_DA_VOLTA	40
+
+#define TAM_FILA	16
+uint32_t area_fila[TAM_FILA];
+fila_t fila;
+
+/* a mesma comunicacao sem a fila: anel de mensagens com um semaforo de 
+ * mensagens e um de espacos livres (um produtor e um consumidor) */
+uint32_t anel[TAM_FILA];
+semaforo_t SemaforoMensagens = {0};
+semaforo_t SemaforoEspacos = {0};
+
+/*
+ * Funcao principal de entrada do sistema
+ */
+int main(void)
+{
+
+	FilaCria(&fila, area_fila, sizeof(uint32_t), TAM_FILA);
+	SemaforoEspacos.contador = TAM_FILA;	/* anel vazio */
+	AvancaMarcasDeTempo((tick_t)0 - MARCAS_ANTES_DA_VOLTA);
+
+	/* Configura marca de tempo */
+	ConfiguraMarcaTempo();
+
+	/* Cria as tarefas da tabela e inicia o sistema multitarefas */
+	IniciaMultitarefas();
+
+	/* Nunca chega aqui */
+	return 0;
+}
+
+/* tarefa ociosa: o tempo (simulado) so avanca quando ela executa */
+void tarefa_ociosa_posix(void)
+{
+	for(;;)
+	{
+		#if cfg_MODO_SEM_MARCA
+			REG_ATOMICA_INICIO();
+			DormeAteProximoDespertar();		/* omite as marcas ate o proximo despertar */
+			REG_ATOMICA_FIM();
+		#endif
+		EsperaMarcaDeTempo();
+		#if !cfg_PREEMPTIVO  /* para o uso como sistema cooperativo*/
+			TrocaContexto();
+		#endif
+	}
+}
+
+static uint64_t Agora(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (uint64_t)t.tv_sec * 1000000000u + (uint64_t)t.tv_nsec;
+}
+
+static void Mostra(const char *nome, uint64_t inicio, uint32_t vezes)
+{
+	uint64_t duracao = Agora() - inicio;
+	printf("%-45s %10.1f ns\n", nome, (double)duracao / vezes);
+}
+
+/* testes do nucleo: a falha termina o programa com erro */
+static void Verifica(int condicao, const char *teste)
+{
+	printf("%-52s %s\n", teste, condicao ? "ok" : "FALHOU");
+	if(!condicao)
+	{
+		exit(1);
+	}
+}
+
+/* TCBs das tarefas dinamicas ainda nao usados ou de tarefas terminadas */
+static int TarefaExiste(uint8_t tarefa)
+{
+	return TCB[tarefa].nome != 0 && TCB[tarefa].estado != TERMINADA;
+}
+
+/* marca de agua das pilhas: menor numero de palavras livres */
+static void MostraPilhas(void)
+{
+	uint8_t tarefa;
+
+	for(tarefa = 1; tarefa <= NUMERO_DE_TAREFAS; tarefa++)
+	{
+		if(!TarefaExiste(tarefa))
+		{
+			continue;
+		}
+		printf("pilha livre da %-15s %5u de %5u palavras\n", TCB[tarefa].nome,
+			TarefaPilhaLivre(tarefa), TCB[tarefa].tamanho_pilha);
+	}
+}
+
+#if cfg_MEDIDAS_REGIAO_ATOMICA
+/* maior tempo com as interrupcoes desabilitadas de cada servico */
+static void MostraRegioesAtomicas(void)
+{
+	regiao_medida_t medidas[cfg_SERVICOS_MEDIDOS];
+	uint8_t i, quantidade;
+
+	quantidade = RegioesAtomicasMedidas(medidas, cfg_SERVICOS_MEDIDOS);
+	for(i = 0; i < quantidade; i++)
+	{
+		printf("interrupcoes desabilitadas em %-22s max %6lu ns\n",
+			medidas[i].servico, (unsigned long)medidas[i].maximo);
+	}
+}
+#endif
+
+#if cfg_ESTATISTICAS
+/* uso da CPU de cada tarefa, inclusive a ociosa */
+static void MostraEstatisticas(void)
+{
+	uint8_t tarefa;
+	estatisticas_tarefa_t estatisticas;
+
+	for(tarefa = 1; tarefa <= NUMERO_DE_TAREFAS; tarefa++)
+	{
+		if(!TarefaExiste(tarefa))
+		{
+			continue;
+		}
+		TarefaEstatisticas(tarefa, &estatisticas);
+		printf("uso da CPU da %-15s %3u.%02u%% (%lu entradas)\n", TCB[tarefa].nome,
+			estatisticas.uso_cpu / 100, estatisticas.uso_cpu % 100,
+			(unsigned long)estatisticas.entradas);
+	}
+}
+#endif
+
+#if cfg_MEDIDAS_LATENCIA
+/* latencias de troca de contexto de cada tarefa (em ns no computador) */
+static void MostraLatencias(void)
+{
+	uint8_t tarefa;
+	latencia_t troca;
+
+	for(tarefa = 1; tarefa <= NUMERO_DE_TAREFAS; tarefa++)
+	{
+		if(!TarefaExiste(tarefa))
+		{
+			continue;
+		}
+		LatenciasTarefa(tarefa, &troca, 0);
+		printf("latencia da troca para a %-15s min %6lu max %6lu media %6lu ns (%lu)\n",
+			TCB[tarefa].nome, (unsigned long)troca.minimo, (unsigned long)troca.maximo,
+			(unsigned long)troca.media, (unsigned long)troca.amostras);
+	}
+}
+#endif
+
+/* trabalho adiado das medidas */
+static volatile uint32_t trabalhos_feitos = 0;
+
+static void ContaTrabalho(void *argumento)
+{
+	(void)argumento;
+	trabalhos_feitos++;
+}
+
+/* cada trabalho coloca o proximo enquanto a tarefa de trabalhos executa, 
+ * mais vezes do que cabe no contador de 8 bits do semaforo */
+#define TRABALHOS_ENCADEADOS	1000
+static volatile uint32_t encadeados_restantes;
+
+static void TrabalhoEncadeado(void *argumento)
+{
+	(void)argumento;
+	if(--encadeados_restantes > 0)
+	{
+		(void)TrabalhoISR(TrabalhoEncadeado, 0);
+	}
+}
+
+static void TestaTrabalhos(void)
+{
+	uint32_t i, aceitos = 0;
+
+	/* anel cheio: guarda cfg_TAM_TRABALHOS - 1 trabalhos, o seguinte e recusado */
+	trabalhos_feitos = 0;
+	REG_ATOMICA_INICIO();
+	for(i = 0; i < cfg_TAM_TRABALHOS; i++)
+	{
+		aceitos += TrabalhoISR(ContaTrabalho, 0) == SUCESSO;
+	}
+	REG_ATOMICA_FIM();
+	Verifica(aceitos == cfg_TAM_TRABALHOS - 1 && trabalhos_feitos == aceitos,
+		"trabalhos: anel cheio recusa o trabalho");
+
+	encadeados_restantes = TRABALHOS_ENCADEADOS;
+	REG_ATOMICA_INICIO();
+	(void)TrabalhoISR(TrabalhoEncadeado, 0);
+	REG_ATOMICA_FIM();
+	Verifica(encadeados_restantes == 0, "trabalhos: encadeados alem do contador do semaforo");
+
+	trabalhos_feitos = 0;
+	REG_ATOMICA_INICIO();
+	(void)TrabalhoISR(ContaTrabalho, 0);
+	REG_ATOMICA_FIM();
+	Verifica(trabalhos_feitos == 1, "trabalhos: executado logo apos os encadeados");
+	trabalhos_feitos = 0;
+}
+
+/*
+ * Conjunto de tarefas para a comparacao dos modos de escalonamento (make modos):
+ * a tarefa 1 (prioridade 2) e periodica, acordada a cada marca de tempo; as 
+ * tarefas 2 e 3 (prioridade 1) fazem unidades de trabalho sem parar e cedem o 
+ * processador a cada CEDE_A_CADA unidades. Requer a marca de tempo real, pois
+ * com a simulada o tempo so avanca na tarefa ociosa
+ */
+#define MARCAS_CONJUNTO		2000	/* duracao das medidas, em marcas de tempo */
+#define VOLTAS_UNIDADE		200		/* tamanho de uma unidade de trabalho */
+#define CEDE_A_CADA			16		/* unidades entre as chamadas de TrocaContexto() */
+
+static volatile uint8_t conjunto_iniciado = 0;
+static volatile uint32_t unidades[2];	/* unidades feitas pelas tarefas 2 e 3 */
+
+/* tempo em que as tarefas de trabalho nao executaram: os intervalos entre as
+ * unidades maiores que o dobro de custo_unidade (ns) sao somados em 
+ * tempo_perdido, descontado o tempo de uma unidade */
+static uint64_t custo_unidade = 0;
+static volatile uint64_t ultima_unidade = 0;
+static volatile uint64_t tempo_perdido = 0;
+
+static void UnidadeDeTrabalho(void)
+{
+	static volatile uint32_t acumulador;
+	uint32_t i;
+
+	for(i = 0; i < VOLTAS_UNIDADE; i++)
+	{
+		acumulador += i * i;
+	}
+}
+
+static void TrabalhaSemParar(volatile uint32_t *contador)
+{
+	uint64_t agora, intervalo;
+
+	for(;;)
+	{
+		UnidadeDeTrabalho();
+
+		agora = Agora();
+		intervalo = agora - ultima_unidade;
+		if(intervalo > 2 * custo_unidade)
+		{
+			tempo_perdido += intervalo - custo_unidade;
+		}
+		ultima_unidade = agora;
+
+		if((++(*contador) % CEDE_A_CADA) == 0)
+		{
+			TrocaContexto();	/* ponto em que a tarefa cede o processador */
+		}
+	}
+}
+
+#if cfg_MARCA_TEMPO_REAL && cfg_MEDIDAS_LATENCIA
+static int ComparaLatencias(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t*)a;
+	uint32_t y = *(const uint32_t*)b;
+
+	return (x > y) - (x < y);
+}
+
+/* vazao das tarefas de trabalho, sobrecarga por marca de tempo e percentis da
+ * latencia da marca de tempo ate a tarefa 1 executar */
+static void MedidasConjunto(void)
+{
+	static const char *modos[] = {"cooperativo", "preemptivo", "preemptivo com rodizio"};
+	static uint32_t latencias[MARCAS_CONJUNTO];
+	amostra_latencia_t amostra;
+	uint32_t i, quantidade = 0;
+	uint32_t unidades_inicio[2], feitas[2];
+	uint64_t inicio, duracao, ocupado = 0, t;
+	int64_t sobrecarga;
+	tick_t marcas;
+
+	/* tempo medio de uma unidade de trabalho */
+	inicio = Agora();
+	for(i = 0; i < 1000; i++)
+	{
+		UnidadeDeTrabalho();
+	}
+	custo_unidade = (Agora() - inicio) / 1000;
+
+	conjunto_iniciado = 1;
+	ultima_unidade = Agora();
+	TarefaContinua(ID_tarefa_2);
+	TarefaContinua(ID_tarefa_3);
+
+	TarefaEspera(1);		/* comeca logo apos uma marca de tempo */
+	inicio = Agora();
+	marcas = MarcasDeTempo();
+	unidades_inicio[0] = unidades[0];
+	unidades_inicio[1] = unidades[1];
+	tempo_perdido = 0;
+
+	for(i = 0; i < MARCAS_CONJUNTO; i++)
+	{
+		TarefaEspera(1);
+		t = Agora();
+		/* a amostra mais recente e a da marca de tempo que acordou esta tarefa */
+		if(LatenciasRecentes(&amostra, 1) == 1 && amostra.tipo == LATENCIA_ISR &&
+			amostra.tarefa == ID_tarefa_1)
+		{
+			latencias[quantidade++] = amostra.ciclos;
+		}
+		ocupado += Agora() - t;
+	}
+
+	duracao = Agora() - inicio;
+	marcas = MarcasDeTempo() - marcas;
+	feitas[0] = unidades[0] - unidades_inicio[0];
+	feitas[1] = unidades[1] - unidades_inicio[1];
+
+	/* o tempo perdido pelas tarefas de trabalho que nao foi da tarefa 1 e a 
+	 * sobrecarga: tratamento das marcas de tempo e trocas de contexto */
+	sobrecarga = (int64_t)tempo_perdido - (int64_t)ocupado;
+
+	printf("\nconjunto de tarefas, modo %s (%lu marcas)\n", 
+		modos[cfg_MODO_ESCALONAMENTO], (unsigned long)marcas);
+	printf("vazao: %.1f unidades/ms (tarefa 2: %lu, tarefa 3: %lu)\n",
+		(double)(feitas[0] + feitas[1]) * 1000000.0 / duracao,
+		(unsigned long)feitas[0], (unsigned long)feitas[1]);
+	printf("sobrecarga por marca de tempo: %.0f ns (%.2f%%)\n",
+		(double)sobrecarga / (marcas ? marcas : 1), (double)sobrecarga * 100.0 / duracao);
+
+	if(quantidade > 0)
+	{
+		qsort(latencias, quantidade, sizeof(latencias[0]), ComparaLatencias);
+		printf("latencia ao acordar (%lu amostras): p50 %lu p90 %lu p99 %lu max %lu ns\n",
+			(unsigned long)quantidade,
+			(unsigned long)latencias[(quantidade - 1) * 50 / 100],
+			(unsigned long)latencias[(quantidade - 1) * 90 / 100],
+			(unsigned long)latencias[(quantidade - 1) * 99 / 100],
+			(unsigned long)latencias[quantidade - 1]);
+	}
+}
+#endif
+
+#if cfg_TAREFAS_DINAMICAS
+/* tarefa dinamica de vida curta: o retorno termina a tarefa e devolve o TCB
+ * e a pilha */
+static volatile uint32_t trabalhadores_executados = 0;
+
+static void Trabalhador(void)
+{
+	trabalhadores_executados++;
+}
+#endif
+
+#if cfg_TEMPORIZADORES
+/*
+ * Atividades periodicas: NUM_ATIVIDADES atividades com periodos de 2 a 9 
+ * marcas, primeiro com um temporizador cada, todas executadas na pilha da 
+ * tarefa de temporizadores, e depois com uma tarefa dinamica cada
+ */
+#define NUM_ATIVIDADES			24
+#define MARCAS_ATIVIDADES		1000
+#define PERIODO_ATIVIDADE(i)	((tick_t)(2 + (i) % 8))
+
+static temporizador_t temporizadores[NUM_ATIVIDADES];
+static volatile uint32_t execucoes_atividades = 0;
+static volatile uint8_t atividades_terminam = 0;
+static volatile uint8_t proxima_atividade = 0;
+
+static void AtividadeTemporizada(void *argumento)
+{
+	(void)argumento;
+	execucoes_atividades++;
+}
+
+#if cfg_TAREFAS_DINAMICAS >= NUM_ATIVIDADES
+/* a mesma atividade, com uma tarefa para cada uma */
+static void AtividadeTarefa(void)
+{
+	tick_t periodo = PERIODO_ATIVIDADE(proxima_atividade++);
+	tick_t ultimo_despertar = MarcasDeTempo();
+
+	while(!atividades_terminam)
+	{
+		TarefaEsperaAte(&ultimo_despertar, periodo);
+		execucoes_atividades++;
+	}
+}
+#endif
+
+static void MostraAtividades(const char *nome, const trocas_contexto_t *antes, 
+	uint32_t execucoes, unsigned long memoria)
+{
+	trocas_contexto_t depois;
+	uint32_t trocas;
+
+	TrocasDeContexto(&depois);
+	trocas = depois.realizadas - antes->realizadas;
+	printf("%u atividades com %-15s %6lu execucoes %6lu trocas (%.2f/execucao) %7lu bytes\n",
+		NUM_ATIVIDADES, nome, (unsigned long)execucoes, (unsigned long)trocas,
+		execucoes ? (double)trocas / execucoes : 0.0, memoria);
+}
+
+/* trocas de contexto e memoria das atividades com temporizadores e com tarefas */
+static void ComparaAtividades(void)
+{
+	trocas_contexto_t antes;
+	uint8_t i;
+
+	execucoes_atividades = 0;
+	TrocasDeContexto(&antes);
+	for(i = 0; i < NUM_ATIVIDADES; i++)
+	{
+		TemporizadorCria(&temporizadores[i], AtividadeTemporizada, 0);
+		TemporizadorInicia(&temporizadores[i], PERIODO_ATIVIDADE(i), PERIODO_ATIVIDADE(i));
+	}
+	TarefaEspera(MARCAS_ATIVIDADES);
+	for(i = 0; i < NUM_ATIVIDADES; i++)
+	{
+		TemporizadorPara(&temporizadores[i]);
+	}
+	MostraAtividades("temporizadores", &antes, execucoes_atividades,
+		(unsigned long)(NUM_ATIVIDADES * sizeof(temporizador_t) + sizeof(tcb_t) +
+		TCB[ID_TarefaTemporizadores].tamanho_pilha * sizeof(uint32_t)));
+
+#if cfg_TAREFAS_DINAMICAS >= NUM_ATIVIDADES
+	execucoes_atividades = 0;
+	atividades_terminam = 0;
+	proxima_atividade = 0;
+	TrocasDeContexto(&antes);
+	for(i = 0; i < NUM_ATIVIDADES; i++)
+	{
+		(void)CriaTarefaDinamica(AtividadeTarefa, "Atividade", 3);
+	}
+	TarefaEspera(MARCAS_ATIVIDADES);
+	MostraAtividades("tarefas", &antes, execucoes_atividades,
+		(unsigned long)(NUM_ATIVIDADES * (sizeof(tcb_t) + cfg_TAM_PILHA_DINAMICA * sizeof(uint32_t))));
+
+	/* as tarefas terminam no proximo despertar */
+	atividades_terminam = 1;
+	TarefaEspera(PERIODO_ATIVIDADE(7) + 1);
+#endif
+}
+#endif
+
+#if cfg_EDF && cfg_PREEMPTIVO
+/*
+ * Conjunto de tarefas periodicas A (custo 2, periodo 5) e B (custo 4, 
+ * periodo 7), com prazo igual ao periodo e utilizacao 2/5 + 4/7 = 97,1%, 
+ * acima do limite de Liu e Layland para duas tarefas (82,8%). Executado 
+ * com prioridades fixas RM (A mais prioritaria) e com a classe EDF. Cada 
+ * marca de tempo de custo e uma chamada a EsperaMarcaDeTempo(), que avanca
+ * o tempo enquanto a tarefa executa
+ */
+#define MARCAS_PERIODICAS	350		/* 10 hiperperiodos */
+#define PILHA_PERIODICA		(TAM_MINIMO_PILHA + 64)
+#define EVENTO_PARTIDA		0x01
+
+typedef struct
+{
+	const char		*nome;
+	tick_t			custo;
+	tick_t			periodo;
+	uint8_t			id;
+	volatile uint32_t trabalhos;
+	volatile uint32_t perdas;
+} periodica_t;
+
+static periodica_t periodicas[2] = 
+{
+	{"A", 2, 5, 0, 0, 0},
+	{"B", 4, 7, 0, 0, 0},
+};
+static uint32_t pilhas_periodicas[2][PILHA_PERIODICA];
+static eventos_t partida = {0};
+static volatile uint8_t periodicas_edf = 0;
+static volatile uint8_t periodicas_terminam = 0;
+
+/* partida simultanea; cada trabalho consome o seu custo em marcas e a 
+ * perda do prazo e verificada pela propria tarefa, nos dois modos */
+static void Periodica(periodica_t *tarefa)
+{
+	tick_t liberacao;
+	tick_t ultimo_despertar;
+	tick_t i;
+
+	(void)EventosAguarda(&partida, EVENTO_PARTIDA, EVENTOS_QUALQUER, 0, ESPERA_INFINITA);
+	liberacao = MarcasDeTempo();
+	ultimo_despertar = liberacao;
+
+	while(!periodicas_terminam)
+	{
+		for(i = 0; i < tarefa->custo; i++)
+		{
+			EsperaMarcaDeTempo();
+		}
+		tarefa->trabalhos++;
+		if((int32_t)(MarcasDeTempo() - (liberacao + tarefa->periodo)) > 0)
+		{
+			tarefa->perdas++;
+		}
+		liberacao += tarefa->periodo;
+
+		if(periodicas_edf)
+		{
+			TarefaAguardaPeriodo();
+		}else
+		{
+			TarefaEsperaAte(&ultimo_despertar, tarefa->periodo);
+		}
+	}
+}
+
+static void PeriodicaA(void)
+{
+	Periodica(&periodicas[0]);
+}
+
+static void PeriodicaB(void)
+{
+	Periodica(&periodicas[1]);
+}
+
+static void ExecutaPeriodicas(uint8_t edf)
+{
+	tarefa_t funcoes[2] = {PeriodicaA, PeriodicaB};
+	uint8_t i;
+
+	periodicas_edf = edf;
+	periodicas_terminam = 0;
+	EventosLimpa(&partida, EVENTO_PARTIDA);
+	for(i = 0; i < 2; i++)
+	{
+		periodicas[i].trabalhos = 0;
+		periodicas[i].perdas = 0;
+		if(edf)
+		{
+			periodicas[i].id = CriaTarefaEDF(funcoes[i], periodicas[i].nome, 
+				pilhas_periodicas[i], PILHA_PERIODICA, periodicas[i].periodo, 0);
+		}else
+		{
+			/* RM: menor periodo, maior prioridade */
+			periodicas[i].id = CriaTarefa(funcoes[i], periodicas[i].nome, 
+				pilhas_periodicas[i], PILHA_PERIODICA, (prioridade_t)(PRIORIDADE_MAXIMA - i));
+		}
+	}
+
+	EventosSinaliza(&partida, EVENTO_PARTIDA);
+	TarefaEspera(MARCAS_PERIODICAS);
+
+	/* as tarefas terminam pelo retorno no proximo trabalho */
+	periodicas_terminam = 1;
+	TarefaEspera(2 * periodicas[1].periodo);
+
+	printf("periodicas %s: ", edf ? "EDF" : "RM ");
+	for(i = 0; i < 2; i++)
+	{
+		printf("%s %3lu trabalhos %3lu perdas de prazo", periodicas[i].nome,
+			(unsigned long)periodicas[i].trabalhos, (unsigned long)periodicas[i].perdas);
+		if(edf)
+		{
+			printf(" (%lu no nucleo)", (unsigned long)TarefaPerdasDePrazo(periodicas[i].id));
+		}
+		printf(i == 0 ? ", " : "\n");
+	}
+}
+
+/* RM e EDF com utilizacao acima do limite de Liu e Layland */
+static void ComparaPeriodicas(void)
+{
+	printf("periodicas: utilizacao %.1f%%, limite RM %.1f%%\n",
+		100.0 * (2.0 / 5 + 4.0 / 7), 100.0 * 2 * (1.41421356 - 1));
+	ExecutaPeriodicas(0);
+	ExecutaPeriodicas(1);
+}
+#endif
+
+#if cfg_ORCAMENTOS && cfg_TAREFAS_DINAMICAS
+/*
+ * Tarefa descontrolada de prioridade maxima, que executa 15 marcas sem 
+ * ceder o processador e espera 10, contra uma tarefa periodica de prioridade 
+ * menor (custo 2, periodo 10). Com orcamento de 5 marcas, a acao no estouro
+ * decide se a tarefa periodica perde os prazos
+ */
+#define MARCAS_ORCAMENTO	200
+#define ORCAMENTO_MARCAS	5
+
+static volatile uint8_t acao_descontrolada;
+static volatile uint8_t orcamento_termina = 0;
+static volatile uint32_t trabalhos_vitima = 0;
+
+static void Descontrolada(void)
+{
+	uint8_t i;
+
+	TarefaOrcamento(tarefa_atual, ORCAMENTO_MARCAS, acao_descontrolada);
+
+	while(!orcamento_termina)
+	{
+		for(i = 0; i < 15 && !orcamento_termina; i++)
+		{
+			EsperaMarcaDeTempo();
+		}
+		TarefaEspera(10);
+	}
+}
+
+static void Vitima(void)
+{
+	tick_t ultimo_despertar = MarcasDeTempo();
+
+	while(!orcamento_termina)
+	{
+		EsperaMarcaDeTempo();
+		EsperaMarcaDeTempo();
+		trabalhos_vitima++;
+		TarefaEsperaAte(&ultimo_despertar, 10);
+	}
+}
+
+static void ExecutaOrcamento(uint8_t acao, const char *nome)
+{
+	uint8_t vitima, descontrolada;
+
+	orcamento_termina = 0;
+	trabalhos_vitima = 0;
+	acao_descontrolada = acao;
+	vitima = CriaTarefaDinamica(Vitima, "Vitima", PRIORIDADE_MAXIMA - 2);
+	descontrolada = CriaTarefaDinamica(Descontrolada, "Descontrolada", PRIORIDADE_MAXIMA);
+	if(vitima == 0 || descontrolada == 0)
+	{
+		printf("erro: sem pilha ou TCB para as tarefas do orcamento\n");
+		return;
+	}
+
+	TarefaEspera(MARCAS_ORCAMENTO);
+	printf("orcamento %-9s: descontrolada %3lu estouros, periodica %3lu trabalhos %3lu perdas de prazo\n",
+		nome, (unsigned long)TarefaEstouros(descontrolada), (unsigned long)trabalhos_vitima,
+		(unsigned long)TarefaPerdasDePrazo(vitima));
+
+	/* a tarefa suspensa e continuada para terminar */
+	orcamento_termina = 1;
+	TarefaContinua(descontrolada);
+	TarefaEspera(30);
+}
+
+static void ComparaOrcamentos(void)
+{
+	ocorrencia_t recentes[4];
+	uint16_t i, quantidade;
+
+	ExecutaOrcamento(ORCAMENTO_CONTA, "conta");
+	ExecutaOrcamento(ORCAMENTO_REBAIXA, "rebaixa");
+	ExecutaOrcamento(ORCAMENTO_SUSPENDE, "suspende");
+
+	quantidade = OcorrenciasRecentes(recentes, 4);
+	for(i = 0; i < quantidade; i++)
+	{
+		printf("ocorrencia na marca %lu: tarefa %u, %s\n", (unsigned long)recentes[i].marca,
+			recentes[i].tarefa, recentes[i].tipo == OCORRENCIA_PRAZO ? "perda de prazo" : "estouro do orcamento");
+	}
+}
+#endif
+
+#if cfg_RASTRO
+/* grava o rastro como a copia da memoria de um equipamento, para o 
+ * decodificador (../ferramentas/decodifica_rastro) */
+static void GravaRastro(const char *arquivo)
+{
+	FILE *saida = fopen(arquivo, "wb");
+
+	if(saida == 0 || fwrite(&rastro, sizeof(rastro), 1, saida) != 1)
+	{
+		printf("erro: rastro nao gravado em %s\n", arquivo);
+	}else
+	{
+		printf("rastro: %lu eventos, %lu gravados em %s\n", (unsigned long)rastro.total,
+			(unsigned long)(rastro.total < cfg_TAM_RASTRO ? rastro.total : cfg_TAM_RASTRO), arquivo);
+	}
+	if(saida != 0)
+	{
+		fclose(saida);
+	}
+}
+#endif
+
+/* interrupcao na janela de PortEsperaTrocaContexto: a tarefa em uma regiao 
+ * critica bloqueia no semaforo e a interrupcao, que usa os servicos, executa
+ * na janela com as interrupcoes habilitadas. A troca pendente deve ser feita
+ * e a espera deve terminar pelo tempo, nao com um falso SUCESSO */
+static semaforo_t semaforo_janela = {0};
+static semaforo_t semaforo_isr = {0};
+static volatile uint8_t isr_janela_executada = 0;
+
+static void InterrupcaoJanela(void)
+{
+	isr_janela_executada = 1;
+	SemaforoLiberaISR(&semaforo_isr);
+}
+
+static void TestaJanelaTroca(void)
+{
+	resultado_t resultado;
+	tick_t inicio;
+
+	REG_ATOMICA_INICIO();
+	PortInterrupcaoSimulada(InterrupcaoJanela);
+	inicio = MarcasDeTempo();
+	resultado = SemaforoAguardaTempo(&semaforo_janela, 3);
+	REG_ATOMICA_FIM();
+
+	Verifica(isr_janela_executada && resultado == TEMPO_ESGOTADO &&
+		(tick_t)(MarcasDeTempo() - inicio) >= 3, "interrupcao na janela da troca de contexto");
+	Verifica(SemaforoAguardaTempo(&semaforo_isr, 0) == SUCESSO, "semaforo liberado pela interrupcao");
+}
+
+/* filas usadas por interrupcao: a interrupcao so copia a mensagem, a tarefa
+ * esperando na outra ponta e acordada na troca de contexto solicitada */
+static fila_t fila_isr;
+static uint32_t area_fila_isr[1];
+static uint32_t mensagem_isr;
+
+static void InterrupcaoEnvia(void)
+{
+	mensagem_isr = 0x1234;
+	(void)FilaEnviaISR(&fila_isr, &mensagem_isr);
+}
+
+static void InterrupcaoRecebe(void)
+{
+	(void)FilaRecebeISR(&fila_isr, &mensagem_isr);
+}
+
+static void TestaFilaISR(void)
+{
+	uint32_t mensagem = 0;
+	resultado_t resultado;
+
+	FilaCria(&fila_isr, area_fila_isr, sizeof(uint32_t), 1);
+
+	/* mensagem enviada pela interrupcao para a tarefa esperando */
+	PortInterrupcaoSimulada(InterrupcaoEnvia);
+	resultado = FilaRecebe(&fila_isr, &mensagem, 3);
+	Verifica(resultado == SUCESSO && mensagem == 0x1234 && FilaQuantidade(&fila_isr) == 0,
+		"fila: envio pela interrupcao acorda o receptor");
+
+	/* espaco aberto pela interrupcao para a tarefa esperando com a fila cheia */
+	mensagem = 1;
+	(void)FilaEnvia(&fila_isr, &mensagem, 0);
+	mensagem = 2;
+	PortInterrupcaoSimulada(InterrupcaoRecebe);
+	resultado = FilaEnvia(&fila_isr, &mensagem, 3);
+	Verifica(resultado == SUCESSO && mensagem_isr == 1 && FilaQuantidade(&fila_isr) == 1,
+		"fila: recebimento pela interrupcao acorda o emissor");
+	(void)FilaRecebe(&fila_isr, &mensagem, 0);
+	Verifica(mensagem == 2, "fila: mensagem do emissor acordado");
+}
+
+/* tempos limite: recebimento da fila vazia e envio para a fila cheia. Com 
+ * tarefas dinamicas, a tarefa que desiste do semaforo sai da lista de espera
+ * e a liberacao seguinte vai para a proxima tarefa esperando */
+static fila_t fila_tempo;
+static uint32_t area_fila_tempo[1];
+
+#if cfg_TAREFAS_DINAMICAS && cfg_PREEMPTIVO
+static semaforo_t semaforo_tempo = {0};
+static volatile resultado_t resultado_desiste;
+static volatile resultado_t resultado_persiste;
+static volatile uint8_t persiste_acordou;
+
+/* prioridade 4: a primeira da lista de espera, desiste em 2 marcas */
+static void DesisteDoSemaforo(void)
+{
+	resultado_desiste = SemaforoAguardaTempo(&semaforo_tempo, 2);
+}
+
+/* prioridade 3: espera sem limite */
+static void PersisteNoSemaforo(void)
+{
+	resultado_persiste = SemaforoAguardaTempo(&semaforo_tempo, ESPERA_INFINITA);
+	persiste_acordou = 1;
+}
+#endif
+
+static void TestaTempoLimite(void)
+{
+	uint32_t mensagem = 0;
+	resultado_t resultado;
+	tick_t inicio;
+
+	FilaCria(&fila_tempo, area_fila_tempo, sizeof(uint32_t), 1);
+
+	inicio = MarcasDeTempo();
+	resultado = FilaRecebe(&fila_tempo, &mensagem, 3);
+	Verifica(resultado == TEMPO_ESGOTADO && (tick_t)(MarcasDeTempo() - inicio) >= 3 &&
+		mensagem == 0, "fila: tempo esgotado no recebimento");
+
+	mensagem = 1;
+	(void)FilaEnvia(&fila_tempo, &mensagem, 0);
+	mensagem = 2;
+	inicio = MarcasDeTempo();
+	resultado = FilaEnvia(&fila_tempo, &mensagem, 3);
+	Verifica(resultado == TEMPO_ESGOTADO && (tick_t)(MarcasDeTempo() - inicio) >= 3 &&
+		FilaQuantidade(&fila_tempo) == 1, "fila: tempo esgotado no envio");
+	resultado = FilaRecebe(&fila_tempo, &mensagem, 0);
+	Verifica(resultado == SUCESSO && mensagem == 1 && FilaQuantidade(&fila_tempo) == 0,
+		"fila: envio esgotado nao altera a fila");
+
+#if cfg_TAREFAS_DINAMICAS && cfg_PREEMPTIVO
+	resultado_desiste = SUCESSO;
+	resultado_persiste = TEMPO_ESGOTADO;
+	persiste_acordou = 0;
+	if(CriaTarefaDinamica(DesisteDoSemaforo, "Desiste", 4) == 0 ||
+		CriaTarefaDinamica(PersisteNoSemaforo, "Persiste", 3) == 0)
+	{
+		printf("erro: sem pilha ou TCB para as tarefas do tempo limite\n");
+		exit(1);
+	}
+	TarefaEspera(3);
+	SemaforoLibera(&semaforo_tempo);
+	Verifica(resultado_desiste == TEMPO_ESGOTADO && persiste_acordou && 
+		resultado_persiste == SUCESSO && semaforo_tempo.contador == 0 &&
+		semaforo_tempo.esperando.primeira == 0, "semaforo: tempo esgotado sai da espera");
+#endif
+}
+
+/* espera periodica atravessando a volta do contador de marcas: cada 
+ * despertar e exatamente k periodos apos o inicio e o contador de 64 bits 
+ * passa a parte alta adiante */
+#define PERIODO_VOLTA	7
+
+static void TestaVoltaMarcas(void)
+{
+	tick_t inicio, ultimo;
+	uint64_t inicio64;
+	uint8_t k;
+	uint8_t exatos = 1;
+
+	inicio64 = MarcasDeTempo64();
+	inicio = (tick_t)inicio64;
+	ultimo = inicio;
+	for(k = 1; k <= 2 * MARCAS_ANTES_DA_VOLTA / PERIODO_VOLTA; k++)
+	{
+		TarefaEsperaAte(&ultimo, PERIODO_VOLTA);
+		if(MarcasDeTempo() != (tick_t)(inicio + k * PERIODO_VOLTA) || ultimo != MarcasDeTempo())
+		{
+			exatos = 0;
+		}
+	}
+	Verifica(exatos && (inicio64 >> 32) == 0 && MarcasDeTempo() < inicio,
+		"volta do contador: despertares exatos");
+	Verifica(MarcasDeTempo64() == inicio64 + (uint64_t)(k - 1) * PERIODO_VOLTA &&
+		(MarcasDeTempo64() >> 32) == 1, "volta do contador: parte alta de 64 bits");
+}
+
+/* grupo de eventos: espera por todos os eventos da mascara, limpeza ao 
+ * acordar, sinalizacao adiada pela interrupcao e tempo esgotado. Com tarefas
+ * dinamicas, uma sinalizacao acorda as duas tarefas satisfeitas e deixa a 
+ * terceira esperando ate o seu tempo limite */
+#define EVENTO_A	0x01
+#define EVENTO_B	0x02
+#define EVENTO_C	0x04
+#define EVENTO_D	0x08
+#define EVENTO_E	0x10
+
+static eventos_t eventos_teste = {0};
+static volatile uint32_t bits_na_isr;
+
+static void InterrupcaoEventos(void)
+{
+	EventosSinalizaISR(&eventos_teste, EVENTO_B);
+	bits_na_isr = eventos_teste.bits;	/* processados so na troca de contexto */
+}
+
+#if cfg_TAREFAS_DINAMICAS && cfg_PREEMPTIVO
+#define NUM_ESPERAS_EVENTOS	3
+
+static const uint32_t mascaras_eventos[NUM_ESPERAS_EVENTOS] = 
+	{EVENTO_C, EVENTO_C | EVENTO_D, EVENTO_E};
+static const uint8_t opcoes_eventos[NUM_ESPERAS_EVENTOS] = 
+	{EVENTOS_QUALQUER, EVENTOS_TODOS | EVENTOS_LIMPA, EVENTOS_QUALQUER};
+static volatile uint8_t esperas_eventos;
+static volatile uint8_t acordadas_eventos;
+static volatile resultado_t resultados_eventos[NUM_ESPERAS_EVENTOS];
+static volatile uint32_t recebidos_eventos[NUM_ESPERAS_EVENTOS];
+
+static void EsperaEventos(void)
+{
+	uint8_t i = esperas_eventos++;		/* executa antes do retorno da criacao */
+	uint32_t recebidos;
+
+	resultados_eventos[i] = EventosAguarda(&eventos_teste, mascaras_eventos[i], 
+		opcoes_eventos[i], &recebidos, 2);
+	recebidos_eventos[i] = recebidos;
+	acordadas_eventos++;
+}
+#endif
+
+static void TestaEventos(void)
+{
+	uint32_t recebidos = 0xFFFFFFFF;
+	resultado_t resultado;
+	tick_t inicio;
+#if cfg_TAREFAS_DINAMICAS && cfg_PREEMPTIVO
+	uint8_t i;
+#endif
+
+	inicio = MarcasDeTempo();
+	resultado = EventosAguarda(&eventos_teste, EVENTO_A, EVENTOS_QUALQUER, &recebidos, 3);
+	Verifica(resultado == TEMPO_ESGOTADO && recebidos == 0 &&
+		(tick_t)(MarcasDeTempo() - inicio) >= 3, "eventos: tempo esgotado");
+
+	/* com somente um dos eventos, a espera por todos nao e satisfeita */
+	EventosSinaliza(&eventos_teste, EVENTO_A);
+	resultado = EventosAguarda(&eventos_teste, EVENTO_A | EVENTO_B, EVENTOS_TODOS, 0, 0);
+	Verifica(resultado == TEMPO_ESGOTADO && eventos_teste.bits == EVENTO_A,
+		"eventos: todos exige todos os eventos");
+
+	/* o outro evento vem da interrupcao e acorda a tarefa, que limpa os dois */
+	bits_na_isr = 0;
+	PortInterrupcaoSimulada(InterrupcaoEventos);
+	resultado = EventosAguarda(&eventos_teste, EVENTO_A | EVENTO_B, 
+		EVENTOS_TODOS | EVENTOS_LIMPA, &recebidos, 3);
+	Verifica(resultado == SUCESSO && recebidos == (EVENTO_A | EVENTO_B) &&
+		bits_na_isr == EVENTO_A, "eventos: interrupcao adiada acorda a espera");
+	Verifica(eventos_teste.bits == 0, "eventos: limpa os eventos ao acordar");
+
+#if cfg_TAREFAS_DINAMICAS && cfg_PREEMPTIVO
+	esperas_eventos = 0;
+	acordadas_eventos = 0;
+	for(i = 0; i < NUM_ESPERAS_EVENTOS; i++)
+	{
+		if(CriaTarefaDinamica(EsperaEventos, "Eventos", 3) == 0)
+		{
+			printf("erro: sem pilha ou TCB para as tarefas dos eventos\n");
+			exit(1);
+		}
+	}
+	EventosSinaliza(&eventos_teste, EVENTO_C | EVENTO_D);
+	Verifica(acordadas_eventos == 2 && 
+		resultados_eventos[0] == SUCESSO && recebidos_eventos[0] == EVENTO_C &&
+		resultados_eventos[1] == SUCESSO && recebidos_eventos[1] == (EVENTO_C | EVENTO_D) &&
+		eventos_teste.bits == 0, "eventos: uma sinalizacao acorda duas tarefas");
+
+	TarefaEspera(3);
+	Verifica(acordadas_eventos == NUM_ESPERAS_EVENTOS && resultados_eventos[2] == TEMPO_ESGOTADO &&
+		recebidos_eventos[2] == 0, "eventos: a terceira tarefa esgota o tempo");
+#endif
+}
+
+#if cfg_TAREFAS_DINAMICAS && cfg_PREEMPTIVO
+/*
+ * Inversao de prioridade com tres tarefas: a baixa (3) trava o recurso por 
+ * MARCAS_TRAVADO marcas, a media (4) ocupa o processador por MARCAS_MEDIA 
+ * marcas e a alta (5) espera o recurso. Com um semaforo binario a alta espera
+ * tambem pela media; com o mutex a baixa herda a prioridade da alta e a 
+ * espera fica limitada ao tempo restante da baixa com o recurso
+ */
+#define MARCAS_TRAVADO		3
+#define MARCAS_MEDIA		20
+#define PRIORIDADE_BAIXA	3
+#define PRIORIDADE_MEDIA	4
+#define PRIORIDADE_ALTA		5
+
+static mutex_t mutex_inversao = {0};
+static semaforo_t semaforo_inversao = {0};
+static volatile uint8_t inversao_com_mutex;
+static volatile uint8_t inversao_tempo_limite;
+static volatile tick_t latencia_alta;
+static volatile uint8_t id_baixa;
+static volatile prioridade_t prioridade_herdada;	/* maior prioridade da baixa com o recurso */
+static volatile prioridade_t prioridade_desistiu;	/* prioridade da baixa apos o tempo limite da alta */
+static volatile resultado_t resultado_alta;
+
+static void Trava(void)
+{
+	if(inversao_com_mutex)
+	{
+		MutexTrava(&mutex_inversao);
+	}else
+	{
+		SemaforoAguarda(&semaforo_inversao);
+	}
+}
+
+static void Destrava(void)
+{
+	if(inversao_com_mutex)
+	{
+		MutexLibera(&mutex_inversao);
+	}else
+	{
+		SemaforoLibera(&semaforo_inversao);
+	}
+}
+
+/* executa as marcas com o recurso travado */
+static void InversaoBaixa(void)
+{
+	uint8_t i;
+
+	id_baixa = tarefa_atual;	/* executa antes do retorno da criacao */
+	Trava();
+	for(i = 0; i < MARCAS_TRAVADO; i++)
+	{
+		EsperaMarcaDeTempo();
+		if(TCB[tarefa_atual].prioridade > prioridade_herdada)
+		{
+			prioridade_herdada = TCB[tarefa_atual].prioridade;
+		}
+	}
+	Destrava();
+}
+
+static void InversaoMedia(void)
+{
+	uint8_t i;
+
+	TarefaEspera(1);
+	for(i = 0; i < MARCAS_MEDIA; i++)
+	{
+		EsperaMarcaDeTempo();
+	}
+}
+
+/* com tempo limite, desiste do mutex uma marca antes de a baixa liberar */
+static void InversaoAlta(void)
+{
+	tick_t inicio;
+
+	TarefaEspera(1);
+	inicio = MarcasDeTempo();
+	if(inversao_tempo_limite)
+	{
+		resultado_alta = MutexTravaTempo(&mutex_inversao, 1);
+		prioridade_desistiu = TCB[id_baixa].prioridade;
+		if(resultado_alta == SUCESSO)
+		{
+			MutexLibera(&mutex_inversao);
+		}
+	}else
+	{
+		Trava();
+		latencia_alta = MarcasDeTempo() - inicio;
+		Destrava();
+	}
+}
+
+/* a alta e a media acordam na primeira marca com o recurso ja travado pela baixa */
+static void ExecutaInversao(uint8_t com_mutex, uint8_t tempo_limite)
+{
+	inversao_com_mutex = com_mutex;
+	inversao_tempo_limite = tempo_limite;
+	latencia_alta = 0;
+	prioridade_herdada = 0;
+	prioridade_desistiu = 0;
+	resultado_alta = SUCESSO;
+	SemaforoLibera(&semaforo_inversao);
+
+	if(CriaTarefaDinamica(InversaoAlta, "Alta", PRIORIDADE_ALTA) == 0 ||
+		CriaTarefaDinamica(InversaoMedia, "Media", PRIORIDADE_MEDIA) == 0 ||
+		CriaTarefaDinamica(InversaoBaixa, "Baixa", PRIORIDADE_BAIXA) == 0)
+	{
+		printf("erro: sem pilha ou TCB para as tarefas da inversao\n");
+		exit(1);
+	}
+
+	/* as tres tarefas terminam pelo retorno */
+	TarefaEspera(MARCAS_TRAVADO + MARCAS_MEDIA + 2);
+	(void)SemaforoAguardaTempo(&semaforo_inversao, 0);
+}
+
+static void TestaInversao(void)
+{
+	tick_t sem_heranca;
+
+	ExecutaInversao(0, 0);
+	sem_heranca = latencia_alta;
+	ExecutaInversao(1, 0);
+	printf("inversao de prioridade: espera da alta %lu marcas com semaforo, %lu com mutex\n",
+		(unsigned long)sem_heranca, (unsigned long)latencia_alta);
+	Verifica(sem_heranca >= MARCAS_MEDIA, "inversao: semaforo espera tambem pela media");
+	Verifica(latencia_alta <= MARCAS_TRAVADO && prioridade_herdada == PRIORIDADE_ALTA,
+		"inversao: mutex limita a espera da alta");
+
+	ExecutaInversao(1, 1);
+	Verifica(resultado_alta == TEMPO_ESGOTADO && prioridade_herdada == PRIORIDADE_ALTA &&
+		prioridade_desistiu == PRIORIDADE_BAIXA, "inversao: tempo limite desfaz a heranca");
+}
+#endif
+
+#if cfg_TAREFAS_DINAMICAS && cfg_PREEMPTIVO
+/*
+ * Ordem de liberacao do semaforo: cinco tarefas esperam, na ordem de 
+ * chegada, com as prioridades 3, 5, 4, 4 e 1. Cada SemaforoLibera acorda a 
+ * de maior prioridade e, entre as de mesma prioridade, a que chegou antes.
+ * A de prioridade 1 e menor que a da tarefa 1 (2): a sua liberacao nao troca
+ * o contexto
+ */
+#define NUM_ESPERAS		5
+
+static semaforo_t semaforo_ordem = {0};
+static const prioridade_t prioridades_ordem[NUM_ESPERAS] = {3, 5, 4, 4, 1};
+static volatile uint8_t chegadas;
+static volatile uint8_t acordadas;
+static volatile uint8_t ordem_acordadas[NUM_ESPERAS];
+
+static void EsperaOrdem(void)
+{
+	uint8_t chegada = chegadas++;		/* executa antes do retorno da criacao */
+
+	SemaforoAguarda(&semaforo_ordem);
+	ordem_acordadas[acordadas++] = chegada;
+}
+
+static void TestaOrdemSemaforo(void)
+{
+	static const uint8_t esperada[NUM_ESPERAS] = {1, 2, 3, 0, 4};
+	trocas_contexto_t antes, depois;
+	uint8_t i;
+	uint8_t ordem_ok = 1;
+
+	chegadas = 0;
+	acordadas = 0;
+	for(i = 0; i < NUM_ESPERAS; i++)
+	{
+		if(CriaTarefaDinamica(EsperaOrdem, "Espera", prioridades_ordem[i]) == 0)
+		{
+			printf("erro: sem pilha ou TCB para as tarefas da ordem do semaforo\n");
+			exit(1);
+		}
+	}
+	TarefaEspera(1);		/* a de prioridade 1 tambem chega ao semaforo */
+
+	for(i = 0; i < NUM_ESPERAS - 1; i++)
+	{
+		SemaforoLibera(&semaforo_ordem);	/* a acordada executa e termina */
+	}
+
+	TrocasDeContexto(&antes);
+	SemaforoLibera(&semaforo_ordem);
+	TrocasDeContexto(&depois);
+	Verifica(chegadas == NUM_ESPERAS && depois.realizadas == antes.realizadas &&
+		acordadas == NUM_ESPERAS - 1, "semaforo: liberar a de menor prioridade nao troca");
+
+	TarefaEspera(1);
+	for(i = 0; i < NUM_ESPERAS; i++)
+	{
+		if(i >= acordadas || ordem_acordadas[i] != esperada[i])
+		{
+			ordem_ok = 0;
+		}
+	}
+	Verifica(ordem_ok, "semaforo: acorda por prioridade, na ordem de chegada");
+}
+#endif
+
+#if cfg_TAREFAS_DINAMICAS >= 16 && cfg_MODO_ESCALONAMENTO == ESCALONAMENTO_FATIA_TEMPO
+/*
+ * Rodizio entre NUM_RODIZIO tarefas de mesma prioridade que nunca cedem o 
+ * processador: cada marca de tempo executada por uma tarefa e contada para
+ * ela, e a parte de cada uma deve ficar a menos de uma fatia da media
+ */
+#define NUM_RODIZIO			16
+#define VOLTAS_RODIZIO		10		/* fatias de cada tarefa durante a medida */
+#define PRIORIDADE_RODIZIO	1		/* abaixo da tarefa 1, que controla a medida */
+
+static volatile uint32_t marcas_rodizio[NUM_RODIZIO];
+static volatile uint8_t proxima_rodizio = 0;
+static volatile uint8_t rodizio_termina = 0;
+
+static void TarefaRodizio(void)
+{
+	uint8_t indice = proxima_rodizio++;
+
+	while(!rodizio_termina)
+	{
+		EsperaMarcaDeTempo();
+		marcas_rodizio[indice]++;
+	}
+}
+
+static void TestaRodizio(void)
+{
+	uint32_t total = 0, minimo = 0xFFFFFFFF, maximo = 0;
+	uint8_t i;
+
+	proxima_rodizio = 0;
+	rodizio_termina = 0;
+	for(i = 0; i < NUM_RODIZIO; i++)
+	{
+		marcas_rodizio[i] = 0;
+		if(CriaTarefaDinamica(TarefaRodizio, "Rodizio", PRIORIDADE_RODIZIO) == 0)
+		{
+			printf("erro: sem pilha ou TCB para as tarefas do rodizio\n");
+			exit(1);
+		}
+	}
+
+	TarefaEspera(NUM_RODIZIO * VOLTAS_RODIZIO * cfg_QUANTUM_MARCAS);
+	rodizio_termina = 1;
+
+	printf("rodizio entre %u tarefas, parte de cada uma:", NUM_RODIZIO);
+	for(i = 0; i < NUM_RODIZIO; i++)
+	{
+		total += marcas_rodizio[i];
+	}
+	for(i = 0; i < NUM_RODIZIO; i++)
+	{
+		printf(" %.1f%%", total ? 100.0 * marcas_rodizio[i] / total : 0.0);
+		minimo = marcas_rodizio[i] < minimo ? marcas_rodizio[i] : minimo;
+		maximo = marcas_rodizio[i] > maximo ? marcas_rodizio[i] : maximo;
+	}
+	printf("\n");
+
+	/* as tarefas terminam pelo retorno na proxima marca que executarem */
+	TarefaEspera(NUM_RODIZIO * cfg_QUANTUM_MARCAS);
+
+	Verifica(total > 0 && maximo - minimo <= cfg_QUANTUM_MARCAS, "rodizio: diferenca de no maximo uma fatia");
+}
+#endif
+
+#if cfg_TAREFAS_DINAMICAS >= 240
+/*
+ * Custo da marca de tempo com muitas tarefas esperando: as esperas ficam na
+ * lista delta, e so a primeira tarefa e decrementada a cada marca. As tarefas
+ * esperam mais que a medida e sao terminadas por TarefaContinua
+ */
+static const uint8_t esperas_medidas[] = {64, 128, 240};
+static uint8_t esperando[240];
+
+static void TarefaEsperando(void)
+{
+	TarefaEspera((tick_t)(2 * NUM_ITERACOES) + tarefa_atual);
+}
+
+static void MedeMarcaComEspera(uint8_t quantidade)
+{
+	char nome[48];
+	uint64_t inicio;
+	uint32_t i;
+
+	for(i = 0; i < quantidade; i++)
+	{
+		/* de prioridade maior: entra na espera antes de a criacao retornar */
+		esperando[i] = CriaTarefaDinamica(TarefaEsperando, "Esperando", 3);
+		if(esperando[i] == 0)
+		{
+			printf("erro: sem pilha ou TCB para as tarefas esperando\n");
+			exit(1);
+		}
+	}
+
+	inicio = Agora();
+	for(i = 0; i < NUM_ITERACOES; i++)
+	{
+		REG_ATOMICA_INICIO();
+		ExecutaMarcaDeTempo();
+		REG_ATOMICA_FIM();
+	}
+	snprintf(nome, sizeof(nome), "marca de tempo com %u tarefas esperando", quantidade);
+	Mostra(nome, inicio, NUM_ITERACOES);
+
+	for(i = 0; i < quantidade; i++)
+	{
+		TarefaContinua(esperando[i]);	/* a espera e interrompida e a tarefa termina */
+	}
+}
+#endif
+
+#if cfg_MODO_SEM_MARCA
+/* modo sem marcas de tempo: com as outras tarefas bloqueadas, a tarefa 
+ * ociosa omite as marcas da espera, e a tarefa acorda na marca exata */
+static void TestaSemMarca(void)
+{
+	tick_t inicio;
+	uint32_t omitidas = MarcasDeTempoOmitidas();
+
+	inicio = MarcasDeTempo();
+	TarefaEspera(50);
+	Verifica(MarcasDeTempo() - inicio == 50, "sem marca: acorda apos 50 marcas");
+#if cfg_MARCA_TEMPO_REAL
+	/* um sinal que chega antes de a tarefa ociosa dormir e contado normalmente */
+	Verifica(MarcasDeTempoOmitidas() - omitidas > 0 && MarcasDeTempoOmitidas() - omitidas <= 49,
+		"sem marca: marcas omitidas, a ultima contada");
+#else
+	Verifica(MarcasDeTempoOmitidas() - omitidas == 49, "sem marca: 49 marcas omitidas, a ultima contada");
+#endif
+}
+#endif
+
+/* tarefa que faz as medidas */
+void tarefa_1(void)
+{
+	uint32_t i;
+	uint32_t mensagem;
+	uint64_t inicio;
+	trocas_contexto_t trocas;
+	volatile uint8_t escolhida;
+	char nome[48];
+
+	TestaVoltaMarcas();
+#if cfg_MODO_SEM_MARCA
+	TestaSemMarca();
+#endif
+	TestaJanelaTroca();
+	TestaFilaISR();
+	TestaEventos();
+	TestaTempoLimite();
+	TestaTrabalhos();
+	Verifica(TarefaApaga(ID_tarefa_ociosa_posix) == INVALIDA && TarefaExiste(ID_tarefa_ociosa_posix),
+		"tarefa ociosa nao pode ser apagada");
+#if cfg_TAREFAS_DINAMICAS && cfg_PREEMPTIVO
+	TestaInversao();
+	TestaOrdemSemaforo();
+#endif
+
+	/* ida e volta entre duas tarefas com semaforos: duas trocas de contexto */
+	inicio = Agora();
+	for(i = 0; i < NUM_ITERACOES; i++)
+	{
+		SemaforoLibera(&SemaforoIda);
+		SemaforoAguarda(&SemaforoVolta);
+	}
+	Mostra("semaforo ida e volta (2 trocas de contexto)", inicio, NUM_ITERACOES);
+
+	/* mensagens de 4 bytes enviadas pela tarefa 2 */
+	inicio = Agora();
+	for(i = 0; i < NUM_ITERACOES; i++)
+	{
+		FilaRecebe(&fila, &mensagem, ESPERA_INFINITA);
+	}
+	Mostra("fila de mensagens (por mensagem)", inicio, NUM_ITERACOES);
+
+	/* as mesmas mensagens pelo anel com semaforos */
+	inicio = Agora();
+	for(i = 0; i < NUM_ITERACOES; i++)
+	{
+		SemaforoAguarda(&SemaforoMensagens);
+		mensagem = anel[i % TAM_FILA];
+		SemaforoLibera(&SemaforoEspacos);
+	}
+	Mostra("anel com semaforos (por mensagem)", inicio, NUM_ITERACOES);
+	if(mensagem != NUM_ITERACOES - 1)
+	{
+		printf("erro: ultima mensagem do anel %lu\n", (unsigned long)mensagem);
+	}
+
+#if cfg_TAREFAS_DINAMICAS >= 16 && cfg_MODO_ESCALONAMENTO == ESCALONAMENTO_FATIA_TEMPO
+	TestaRodizio();
+#endif
+
+	/* tratamento da marca de tempo, sem troca de contexto */
+	inicio = Agora();
+	for(i = 0; i < NUM_ITERACOES; i++)
+	{
+		REG_ATOMICA_INICIO();
+		ExecutaMarcaDeTempo();
+		REG_ATOMICA_FIM();
+	}
+	Mostra("marca de tempo (ExecutaMarcaDeTempo)", inicio, NUM_ITERACOES);
+#if cfg_TAREFAS_DINAMICAS >= 240
+	for(i = 0; i < sizeof(esperas_medidas); i++)
+	{
+		MedeMarcaComEspera(esperas_medidas[i]);
+	}
+#endif
+
+	/* continua a tarefa 2, de menor prioridade: a troca de contexto e evitada */
+	inicio = Agora();
+	for(i = 0; i < NUM_ITERACOES; i++)
+	{
+		TarefaContinua(ID_tarefa_2);
+	}
+	Mostra("TarefaContinua sem troca de contexto", inicio, NUM_ITERACOES);
+
+	/* escolha da proxima tarefa: com o mapa de bits das prioridades prontas o
+	 * tempo nao depende do numero de prioridades (make escalonador) */
+	inicio = Agora();
+	for(i = 0; i < 10 * NUM_ITERACOES; i++)
+	{
+		escolhida = escalonador();
+	}
+	(void)escolhida;
+	snprintf(nome, sizeof(nome), "escalonador (%u prioridades)", PRIORIDADE_MAXIMA + 1);
+	Mostra(nome, inicio, 10 * NUM_ITERACOES);
+
+	/* trabalho colocado por uma "interrupcao" (interrupcoes desabilitadas) e
+	 * executado pela tarefa de trabalhos ao habilitar as interrupcoes */
+	inicio = Agora();
+	for(i = 0; i < NUM_ITERACOES; i++)
+	{
+		REG_ATOMICA_INICIO();
+		(void)TrabalhoISR(ContaTrabalho, 0);
+		REG_ATOMICA_FIM();
+	}
+	Mostra("trabalho adiado (TrabalhoISR ate a execucao)", inicio, NUM_ITERACOES);
+	if(trabalhos_feitos != NUM_ITERACOES)
+	{
+		printf("erro: %lu trabalhos executados\n", (unsigned long)trabalhos_feitos);
+	}
+
+#if cfg_TAREFAS_DINAMICAS
+	/* tarefa dinamica de prioridade maior: executa logo na criacao e termina
+	 * pelo retorno, entao a pilha e o TCB sao reaproveitados a cada vez */
+	inicio = Agora();
+	for(i = 0; i < NUM_ITERACOES / 10; i++)
+	{
+		if(CriaTarefaDinamica(Trabalhador, "Trabalhador", PRIORIDADE_MAXIMA) == 0)
+		{
+			printf("erro: sem pilha ou TCB para a tarefa dinamica\n");
+			break;
+		}
+	}
+	Mostra("tarefa dinamica criada, executada e terminada", inicio, NUM_ITERACOES / 10);
+	if(trabalhadores_executados != NUM_ITERACOES / 10)
+	{
+		printf("erro: %lu tarefas dinamicas executadas\n", (unsigned long)trabalhadores_executados);
+	}
+#endif
+
+#if cfg_TEMPORIZADORES
+	ComparaAtividades();
+#endif
+#if cfg_RASTRO
+	RastroInicia();
+#endif
+#if cfg_EDF && cfg_PREEMPTIVO
+	ComparaPeriodicas();
+#endif
+#if cfg_ORCAMENTOS && cfg_TAREFAS_DINAMICAS
+	ComparaOrcamentos();
+#endif
+#if cfg_RASTRO
+	RastroPara();
+	GravaRastro("rastro.bin");
+#endif
+
+	/* contadores das trocas de contexto durante as medidas */
+	TrocasDeContexto(&trocas);
+	printf("trocas de contexto: %lu realizadas, %lu evitadas, %lu abreviadas\n",
+		(unsigned long)trocas.realizadas, (unsigned long)trocas.evitadas,
+		(unsigned long)trocas.abreviadas);
+
+#if cfg_MEDIDAS_LATENCIA
+	MostraLatencias();
+#endif
+#if cfg_ESTATISTICAS
+	MostraEstatisticas();
+#endif
+#if cfg_MEDIDAS_REGIAO_ATOMICA
+	MostraRegioesAtomicas();
+#endif
+	MostraPilhas();
+
+#if cfg_MARCA_TEMPO_REAL && cfg_MEDIDAS_LATENCIA
+	MedidasConjunto();
+#endif
+
+	exit(0);
+}
+
+/* tarefa parceira das medidas */
+void tarefa_2(void)
+{
+	uint32_t i;
+
+	for(i = 0; i < NUM_ITERACOES; i++)
+	{
+		SemaforoAguarda(&SemaforoIda);
+		SemaforoLibera(&SemaforoVolta);
+	}
+
+	for(i = 0; i < NUM_ITERACOES; i++)
+	{
+		FilaEnvia(&fila, &i, ESPERA_INFINITA);
+	}
+
+	for(i = 0; i < NUM_ITERACOES; i++)
+	{
+		SemaforoAguarda(&SemaforoEspacos);
+		anel[i % TAM_FILA] = i;
+		SemaforoLibera(&SemaforoMensagens);
+	}
+
+	while(!conjunto_iniciado)
+	{
+		TarefaSuspende(ID_tarefa_2);
+	}
+
+	TrabalhaSemParar(&unidades[0]);
+}
+
+/* tarefa de trabalho do conjunto de tarefas, de mesma prioridade da tarefa 2 */
+void tarefa_3(void)
+{
+	while(!conjunto_iniciado)
+	{
+		TarefaSuspende(ID_tarefa_3);
+	}
+
+	TrabalhaSemParar(&unidades[1]);
+}